@@ -0,0 +1,113 @@
+#ifndef BENCHMARK_HPP
+#define BENCHMARK_HPP
+
+#include <string>
+#include <vector>
+#include <functional>
+#include <ostream>
+#include <memory>
+#include "../grid/Grid.hpp"
+#include "PerfCounters.hpp"
+
+/**
+ * @brief Paramètres d'un cas de mesure
+ */
+struct BenchmarkCase {
+    std::string name;                   ///< Nom de l'opération mesurée
+    int width = 0;                      ///< Largeur de la grille
+    int height = 0;                     ///< Hauteur de la grille
+    double density = 0.0;               ///< Densité initiale
+    bool toroidal = false;              ///< Mode torique
+    unsigned int threads = 1;           ///< Nombre de threads
+};
+
+/**
+ * @brief Résultat d'un cas de mesure
+ */
+struct BenchmarkResult {
+    BenchmarkCase params;               ///< Cas mesuré
+    int repetitions = 0;                ///< Nombre de mesures
+    double minSeconds = 0.0;            ///< Durée minimale d'une exécution
+    double medianSeconds = 0.0;         ///< Durée médiane d'une exécution
+    double meanSeconds = 0.0;           ///< Durée moyenne d'une exécution
+    double cellsPerSecond = 0.0;        ///< Cellules traitées par seconde (sur la médiane)
+    double cellsPerRun = 0.0;           ///< Cellules traitées par exécution
+    bool hasCounters = false;           ///< Compteurs matériels mesurés
+    PerfSample counters;                ///< Compteurs matériels moyens par exécution
+};
+
+/**
+ * @brief Mesure de durée avec échauffement et répétitions
+ *
+ * Chaque exécution est chronométrée avec une horloge monotone. Les exécutions
+ * d'échauffement ne sont pas comptées (caches, allocateur, fréquence CPU).
+ */
+class Benchmark {
+private:
+    int m_warmup;                       ///< Exécutions d'échauffement
+    int m_repetitions;                  ///< Exécutions mesurées
+    PerfCounters* m_counters;           ///< Compteurs matériels (nullptr = non mesurés)
+
+public:
+    /**
+     * @brief Constructeur
+     * @param warmup Nombre d'exécutions d'échauffement
+     * @param repetitions Nombre d'exécutions mesurées (au moins 1)
+     */
+    Benchmark(int warmup, int repetitions);
+
+    int getWarmup() const { return m_warmup; }
+    int getRepetitions() const { return m_repetitions; }
+
+    /**
+     * @brief Mesure aussi les compteurs matériels autour de chaque exécution chronométrée
+     * @param counters Compteurs (non possédés), nullptr pour désactiver
+     */
+    void setCounters(PerfCounters* counters) { m_counters = counters; }
+
+    /**
+     * @brief Mesure une opération
+     * @param params Cas mesuré
+     * @param cellsPerRun Nombre de cellules traitées par exécution
+     * @param run Opération chronométrée
+     * @param setup Préparation non chronométrée avant chaque exécution (optionnelle)
+     * @return Résultat de la mesure
+     */
+    BenchmarkResult measure(const BenchmarkCase& params, double cellsPerRun,
+                            const std::function<void()>& run,
+                            const std::function<void()>& setup = nullptr) const;
+
+    /**
+     * @brief Crée une grille aléatoire reproductible
+     * @param width Largeur
+     * @param height Hauteur
+     * @param density Probabilité qu'une cellule soit vivante
+     * @param toroidal Mode torique
+     * @param seed Graine
+     * @return Nouvelle grille
+     */
+    static std::unique_ptr<Grid> makeRandomGrid(int width, int height, double density, bool toroidal,
+                                                std::uint64_t seed = 1);
+
+    /**
+     * @brief Écrit l'en-tête du tableau de résultats
+     */
+    static void printHeader(std::ostream& out);
+
+    /**
+     * @brief Écrit une ligne du tableau de résultats
+     */
+    static void printResult(std::ostream& out, const BenchmarkResult& result);
+
+    /**
+     * @brief Écrit les compteurs matériels d'un résultat, rapportés à une cellule
+     */
+    static void printCounters(std::ostream& out, const BenchmarkResult& result);
+
+    /**
+     * @brief Écrit les résultats au format CSV (compteurs par cellule, vides si non mesurés)
+     */
+    static void writeCsv(std::ostream& out, const std::vector<BenchmarkResult>& results);
+};
+
+#endif // BENCHMARK_HPP
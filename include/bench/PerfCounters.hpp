@@ -0,0 +1,90 @@
+#ifndef PERFCOUNTERS_HPP
+#define PERFCOUNTERS_HPP
+
+#include <string>
+#include <cstdint>
+
+/**
+ * @brief Valeurs des compteurs matériels pour une mesure
+ */
+struct PerfSample {
+    static constexpr int EVENT_COUNT = 5;
+
+    double values[EVENT_COUNT] = {};    ///< Valeurs (corrigées du multiplexage)
+    bool valid[EVENT_COUNT] = {};       ///< Compteur disponible et effectivement actif
+};
+
+/**
+ * @brief Compteurs matériels du processeur (perf_event_open, Linux uniquement)
+ *
+ * Chaque compteur est ouvert séparément pour le thread appelant et les threads qu'il
+ * crée ensuite (espace utilisateur seulement). Les threads terminés ajoutent leurs
+ * comptes à ceux du compteur sans qu'une remise à zéro ne les efface : une mesure est
+ * donc la différence entre les lectures de start() et de stop(). Un événement non supporté par le
+ * processeur ou refusé par le noyau (perf_event_paranoid, conteneur) est simplement
+ * marqué invalide. Sur les autres systèmes, aucun compteur n'est disponible et les
+ * mesures restent possibles sans eux.
+ */
+class PerfCounters {
+public:
+    /**
+     * @brief Événements mesurés (indices dans PerfSample)
+     */
+    enum Event {
+        Cycles,             ///< Cycles processeur
+        Instructions,       ///< Instructions exécutées
+        CacheMisses,        ///< Défauts du dernier niveau de cache
+        BranchMisses,       ///< Branchements mal prédits
+        TlbMisses,          ///< Défauts de TLB données (lectures)
+        EventCount
+    };
+
+private:
+    int m_fds[EventCount];              ///< Descripteurs perf (-1 si indisponible)
+    std::uint64_t m_start[EventCount][3];   ///< Valeur, temps activé et temps compté au start()
+    bool m_startValid[EventCount];      ///< Lecture de départ réussie
+    std::string m_error;                ///< Raison de l'indisponibilité du premier compteur refusé
+
+public:
+    /**
+     * @brief Ouvre les compteurs (désactivés) pour le thread courant et ses futurs threads
+     */
+    PerfCounters();
+
+    ~PerfCounters();
+
+    PerfCounters(const PerfCounters&) = delete;
+    PerfCounters& operator=(const PerfCounters&) = delete;
+
+    /**
+     * @brief Au moins un compteur est disponible
+     */
+    bool isAvailable() const;
+
+    /**
+     * @brief Le compteur d'un événement est disponible
+     */
+    bool isAvailable(Event event) const { return m_fds[event] >= 0; }
+
+    /**
+     * @brief Raison pour laquelle un compteur n'a pas pu être ouvert (vide si tous le sont)
+     */
+    const std::string& getError() const { return m_error; }
+
+    /**
+     * @brief Nom court d'un événement (ex: "cycles")
+     */
+    static const char* getEventName(Event event);
+
+    /**
+     * @brief Lit les valeurs de départ et démarre les compteurs
+     */
+    void start();
+
+    /**
+     * @brief Arrête les compteurs et retourne leur progression depuis start()
+     */
+    PerfSample stop();
+};
+
+#endif // PERFCOUNTERS_HPP
@@ -0,0 +1,135 @@
+#ifndef SCENARIO_HPP
+#define SCENARIO_HPP
+
+#include <string>
+#include <vector>
+#include <map>
+#include <ostream>
+#include <cstdint>
+#include "Benchmark.hpp"
+
+/**
+ * @brief Scénario de bout en bout décrit par une ligne du fichier de scénarios
+ *
+ * Types disponibles :
+ * - soup : grille aléatoire (densité, graine, obstacles aléatoires)
+ * - file : fichier d'entrée (.txt ou .mc), chemin relatif au fichier de scénarios
+ * - fleet : flotte de vaisseaux (pattern prédéfini répété tous les spacing cellules)
+ * - console : exécution complète du mode console avec écriture des itérations
+ */
+struct Scenario {
+    std::string name;                   ///< Nom unique du scénario
+    std::string kind;                   ///< Type (soup, file, fleet, console)
+    int width = 256;                    ///< Largeur (soup, fleet)
+    int height = 256;                   ///< Hauteur (soup, fleet)
+    double density = 0.5;               ///< Densité de cellules vivantes (soup)
+    double obstacles = 0.0;             ///< Densité d'obstacles (soup)
+    std::uint64_t seed = 1;             ///< Graine (soup)
+    std::string file;                   ///< Fichier d'entrée (file, console)
+    std::string pattern = "glider";     ///< Pattern répété (fleet)
+    int spacing = 16;                   ///< Espacement des vaisseaux (fleet)
+    std::string format = "txt";         ///< Format des itérations écrites (console)
+    int generations = 100;              ///< Générations simulées
+    bool toroidal = false;              ///< Mode torique
+    int warmup = 1;                     ///< Exécutions d'échauffement
+    int repetitions = 3;                ///< Exécutions mesurées
+    double threshold = -1.0;            ///< Seuil de régression en % (négatif = seuil global)
+};
+
+/**
+ * @brief Résultat d'un scénario
+ */
+struct ScenarioResult {
+    std::string name;                   ///< Nom du scénario
+    std::string kind;                   ///< Type du scénario
+    int width = 0;                      ///< Largeur de la grille
+    int height = 0;                     ///< Hauteur de la grille
+    int generations = 0;                ///< Générations effectivement simulées
+    int repetitions = 0;                ///< Nombre de mesures
+    double medianSeconds = 0.0;         ///< Durée médiane d'une exécution
+    double minSeconds = 0.0;            ///< Durée minimale d'une exécution
+    double cellsPerSecond = 0.0;        ///< Mises à jour de cellules par seconde (sur la médiane)
+    int population = 0;                 ///< Cellules vivantes à la fin
+    std::uint64_t hash = 0;             ///< Empreinte de la grille finale (0 = non vérifiée)
+};
+
+/**
+ * @brief Comparaison d'un résultat avec la référence
+ */
+struct ScenarioComparison {
+    /**
+     * @brief État de la comparaison
+     */
+    enum class Status { Ok, Regression, Mismatch, New };
+
+    std::string name;                   ///< Nom du scénario
+    double baselineSeconds = 0.0;       ///< Durée médiane de référence
+    double currentSeconds = 0.0;        ///< Durée médiane mesurée
+    double changePercent = 0.0;         ///< Écart relatif en % (positif = plus lent)
+    double threshold = 0.0;             ///< Seuil appliqué en %
+    Status status = Status::New;        ///< État
+};
+
+/**
+ * @brief Suite de scénarios de bout en bout avec comparaison à une référence CSV
+ *
+ * Chaque scénario est chronométré de bout en bout (construction du Game exclue, écriture
+ * des fichiers incluse pour le type console). La population et l'empreinte finales sont
+ * enregistrées avec les durées : une différence avec la référence signale un changement
+ * de résultat, pas seulement de performance.
+ */
+class ScenarioSuite {
+public:
+    /**
+     * @brief Lit un fichier de scénarios
+     *
+     * Une ligne par scénario : "<nom> <type> clé=valeur ...". Lignes vides et
+     * commentaires (#) ignorés. Les chemins relatifs sont résolus depuis le dossier du fichier.
+     *
+     * @param filename Fichier de scénarios
+     * @return Scénarios dans l'ordre du fichier
+     * @throw std::runtime_error si le fichier est illisible ou invalide
+     */
+    static std::vector<Scenario> loadFile(const std::string& filename);
+
+    /**
+     * @brief Exécute un scénario
+     * @param scenario Scénario à exécuter
+     * @return Résultat (durées et état final)
+     * @throw std::runtime_error si le scénario ne peut pas être exécuté
+     */
+    static ScenarioResult run(const Scenario& scenario);
+
+    /**
+     * @brief Écrit les résultats au format CSV
+     * @param out Flux de sortie
+     * @param results Résultats
+     * @param prefix Colonnes ajoutées en tête de chaque ligne (historique), sans virgule finale
+     * @param withHeader Écrire la ligne d'en-tête
+     */
+    static void writeCsv(std::ostream& out, const std::vector<ScenarioResult>& results,
+                         const std::string& prefix = "", bool withHeader = true);
+
+    /**
+     * @brief Lit une référence écrite par writeCsv (sans préfixe)
+     * @param filename Fichier CSV
+     * @return Résultats indexés par nom de scénario
+     * @throw std::runtime_error si le fichier est illisible ou invalide
+     */
+    static std::map<std::string, ScenarioResult> loadBaseline(const std::string& filename);
+
+    /**
+     * @brief Compare des résultats à la référence
+     * @param results Résultats mesurés
+     * @param scenarios Scénarios (seuils propres)
+     * @param baseline Référence
+     * @param defaultThreshold Seuil global en %
+     * @return Une comparaison par résultat
+     */
+    static std::vector<ScenarioComparison> compare(const std::vector<ScenarioResult>& results,
+                                                   const std::vector<Scenario>& scenarios,
+                                                   const std::map<std::string, ScenarioResult>& baseline,
+                                                   double defaultThreshold);
+};
+
+#endif // SCENARIO_HPP
@@ -45,6 +45,19 @@ public:
      * @return 1 si vivant, 0 si mort
      */
     virtual int toInt() const = 0;
+    
+    /**
+     * @brief Retourne le code complet de l'état (format des fichiers d'entrée)
+     * @return 0 mort, 1 vivant, 2 obstacle mort, 3 obstacle vivant
+     */
+    int toCode() const { return (isObstacle() ? 2 : 0) + (isAlive() ? 1 : 0); }
+    
+    /**
+     * @brief Crée un état à partir de son code (format des fichiers d'entrée)
+     * @param code 0 mort, 1 vivant, 2 obstacle mort, 3 obstacle vivant
+     * @return Nouvel état, ou nullptr si le code est invalide
+     */
+    static std::unique_ptr<CellState> fromCode(int code);
 };
 
 #endif // CELLSTATE_HPP
@@ -0,0 +1,143 @@
+#ifndef AUTOTUNER_HPP
+#define AUTOTUNER_HPP
+
+#include <string>
+#include <vector>
+#include <functional>
+#include <cstdint>
+
+/**
+ * @brief Stratégie de mise à jour de la grille
+ */
+struct TuningConfig {
+    bool parallel = false;              ///< Calcul parallèle
+    unsigned int threads = 0;           ///< Nombre de threads (mode parallèle)
+    int bandRows = 0;                   ///< Lignes par bande (0 = une bande par thread)
+    double cellsPerSecond = 0.0;        ///< Débit mesuré
+
+    /**
+     * @brief Description courte (ex: "parallèle 4 threads, bandes de 32 lignes")
+     */
+    std::string describe() const;
+};
+
+/**
+ * @brief Profil de réglage : meilleure stratégie mesurée par classe de charge
+ *
+ * Une charge est identifiée par sa taille (log2 du nombre de cellules, arrondi), sa densité
+ * (au dixième) et sa topologie. Le profil est un fichier texte local, une entrée par ligne :
+ *
+ *     cells=2^16 density=0.3 toroidal=0 parallel=1 threads=4 band=32 rate=1.5e+06
+ */
+class TuningProfile {
+public:
+    /**
+     * @brief Entrée du profil
+     */
+    struct Entry {
+        int sizeClass = 0;              ///< log2 arrondi du nombre de cellules
+        int densityClass = 0;           ///< Densité en dixièmes (0 à 10)
+        bool toroidal = false;          ///< Topologie
+        TuningConfig config;            ///< Stratégie retenue
+    };
+
+private:
+    std::vector<Entry> m_entries;
+
+public:
+    /**
+     * @brief Chemin du profil par défaut ($GAMEOFLIFE_TUNING, sinon gameoflife_tuning.cfg)
+     */
+    static std::string defaultPath();
+
+    /**
+     * @brief Charge un profil (un fichier absent donne un profil vide)
+     * @throw std::runtime_error si une ligne est invalide
+     */
+    static TuningProfile load(const std::string& path);
+
+    /**
+     * @brief Charge le profil par défaut ; un profil illisible est ignoré (profil vide)
+     */
+    static TuningProfile loadDefault();
+
+    /**
+     * @brief Écrit le profil
+     * @throw std::runtime_error si le fichier ne peut pas être écrit
+     */
+    void save(const std::string& path) const;
+
+    static int sizeClass(int width, int height);
+    static int densityClass(double density);
+
+    /**
+     * @brief Enregistre (ou remplace) la stratégie d'une classe de charge
+     */
+    void set(int width, int height, double density, bool toroidal, const TuningConfig& config);
+
+    /**
+     * @brief Stratégie de la classe la plus proche (même topologie, taille puis densité)
+     *
+     * L'entrée n'est retenue que si sa taille est à une classe au plus de la grille, ou si
+     * la grille est encadrée par des entrées plus petite et plus grande.
+     * @return nullptr si aucune entrée ne correspond à la topologie ou n'est assez proche
+     */
+    const TuningConfig* find(int width, int height, double density, bool toroidal) const;
+
+    const std::vector<Entry>& getEntries() const { return m_entries; }
+    bool empty() const { return m_entries.empty(); }
+};
+
+/**
+ * @brief Mesure les stratégies de mise à jour disponibles sur une soupe aléatoire
+ *
+ * Chaque candidat (séquentiel, puis parallèle pour plusieurs nombres de threads et tailles
+ * de bande) simule la même soupe pendant une durée fixe ; le plus rapide est retenu.
+ */
+class AutoTuner {
+public:
+    /**
+     * @brief Fonction appelée après la mesure de chaque candidat
+     */
+    using ProgressCallback = std::function<void(const TuningConfig& config)>;
+
+private:
+    int m_width;
+    int m_height;
+    double m_density;
+    bool m_toroidal;
+    std::uint64_t m_seed;
+
+public:
+    /**
+     * @brief Constructeur
+     * @throw std::invalid_argument si la taille ou la densité est invalide
+     */
+    AutoTuner(int width, int height, double density, bool toroidal, std::uint64_t seed = 1);
+
+    /**
+     * @brief Stratégies à mesurer sur cette machine
+     * @param maxThreads Nombre maximal de threads (0 = nombre de cœurs)
+     */
+    std::vector<TuningConfig> candidates(unsigned int maxThreads = 0) const;
+
+    /**
+     * @brief Mesure chaque candidat (trois passes entrelacées, meilleur débit conservé)
+     * @param secondsPerCandidate Durée totale de mesure de chaque candidat
+     * @param onMeasured Fonction appelée après chaque mesure (optionnelle)
+     * @param maxThreads Nombre maximal de threads (0 = nombre de cœurs)
+     * @return Candidats avec leur débit, dans l'ordre de candidates()
+     */
+    std::vector<TuningConfig> run(double secondsPerCandidate, const ProgressCallback& onMeasured = nullptr,
+                                  unsigned int maxThreads = 0) const;
+
+    /**
+     * @brief Candidat le plus rapide
+     *
+     * Une stratégie parallèle n'est retenue que si elle dépasse le séquentiel d'au moins 5 % :
+     * en deçà, l'écart relève du bruit de mesure et les threads occupent des cœurs pour rien.
+     */
+    static TuningConfig best(const std::vector<TuningConfig>& measured);
+};
+
+#endif // AUTOTUNER_HPP
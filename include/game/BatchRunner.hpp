@@ -0,0 +1,98 @@
+#ifndef BATCHRUNNER_HPP
+#define BATCHRUNNER_HPP
+
+#include <string>
+#include <vector>
+#include <functional>
+#include <ostream>
+
+/**
+ * @brief Paramètres communs à toutes les simulations d'un lot
+ */
+struct BatchOptions {
+    int iterations = 100;                   ///< Nombre maximal d'itérations
+    bool toroidal = false;                  ///< Mode torique
+    bool writeOutputs = true;               ///< Écrire les dossiers _out
+    std::string outputExtension = ".txt";   ///< Format des fichiers d'itérations
+    std::string outputRoot;                 ///< Dossier parent des dossiers _out (vide = dossier courant)
+    int maxPeriod = 64;                     ///< Période maximale des cycles détectés
+    unsigned int threadCount = 0;           ///< Nombre de threads (0 = nombre de cœurs)
+};
+
+/**
+ * @brief Résultat de la simulation d'un fichier
+ */
+struct BatchResult {
+    std::string inputFile;                  ///< Fichier d'entrée
+    std::string outputDir;                  ///< Dossier de sortie (vide si non écrit)
+    bool success = false;                   ///< La simulation a pu être exécutée
+    std::string error;                      ///< Message d'erreur en cas d'échec
+    int width = 0;                          ///< Largeur de la grille
+    int height = 0;                         ///< Hauteur de la grille
+    int finalGeneration = 0;                ///< Dernière génération calculée
+    int population = 0;                     ///< Cellules vivantes à la dernière génération
+    int period = 0;                         ///< Période du cycle final (1 = stable, 0 = aucun)
+    double seconds = 0.0;                   ///< Durée de la simulation
+};
+
+/**
+ * @brief Exécute un lot de fichiers de configuration dans un seul processus
+ *
+ * Chaque fichier est simulé séquentiellement, mais les fichiers sont répartis sur un
+ * groupe de threads partagé : tous les cœurs sont occupés même quand chaque grille est
+ * trop petite pour que le calcul parallèle d'une génération soit rentable. Les fichiers
+ * les plus gros sont lancés en premier pour équilibrer la fin du lot.
+ */
+class BatchRunner {
+public:
+    /**
+     * @brief Fonction appelée à la fin de chaque fichier (appels sérialisés)
+     */
+    using ResultCallback = std::function<void(const BatchResult& result, size_t done, size_t total)>;
+
+private:
+    BatchOptions m_options;
+
+    /**
+     * @brief Simule un fichier
+     */
+    BatchResult runOne(const std::string& inputFile, const std::string& outputDir) const;
+
+public:
+    /**
+     * @brief Constructeur
+     * @param options Paramètres du lot
+     */
+    explicit BatchRunner(const BatchOptions& options);
+
+    /**
+     * @brief Liste les fichiers d'un lot
+     *
+     * Un dossier donne tous ses fichiers .txt et .mc (triés par nom). Sinon, la source
+     * est un manifeste : un chemin par ligne, lignes vides et commentaires (#) ignorés,
+     * chemins relatifs résolus par rapport au dossier du manifeste.
+     *
+     * @param source Dossier ou manifeste
+     * @return Chemins des fichiers d'entrée
+     * @throw std::runtime_error si la source ne peut pas être lue
+     */
+    static std::vector<std::string> collectInputs(const std::string& source);
+
+    /**
+     * @brief Exécute toutes les simulations
+     * @param inputs Fichiers d'entrée
+     * @param onResult Fonction appelée à la fin de chaque fichier (optionnelle)
+     * @return Résultats, dans l'ordre des fichiers d'entrée
+     */
+    std::vector<BatchResult> run(const std::vector<std::string>& inputs,
+                                 const ResultCallback& onResult = nullptr) const;
+
+    /**
+     * @brief Écrit le tableau récapitulatif au format CSV
+     * @param results Résultats du lot
+     * @param out Flux de sortie
+     */
+    static void writeSummary(const std::vector<BatchResult>& results, std::ostream& out);
+};
+
+#endif // BATCHRUNNER_HPP
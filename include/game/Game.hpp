@@ -4,9 +4,13 @@
 #include <memory>
 #include <string>
 #include <functional>
+#include <deque>
+#include <cstdint>
 #include "../grid/Grid.hpp"
 #include "../rules/Rule.hpp"
 
+class TuningProfile;
+
 /**
  * @brief Classe principale gérant le jeu de la vie
  * 
@@ -21,7 +25,18 @@ private:
     int m_maxIterations;                    ///< Nombre maximum d'itérations (0 = infini)
     bool m_running;                         ///< État de la simulation
     bool m_parallel;                        ///< Mode parallèle activé
+    unsigned int m_threadCount;             ///< Threads du mode parallèle (0 = nombre de cœurs)
+    int m_bandRows;                         ///< Lignes par bande du mode parallèle (0 = une bande par thread)
     Grid m_previousGrid;                    ///< Grille précédente (pour détecter la stabilité)
+    int m_maxPeriod;                        ///< Période maximale des cycles détectés (0 = désactivé)
+    int m_period;                           ///< Période du cycle détecté (0 = aucun)
+    std::deque<std::uint64_t> m_history;    ///< Empreintes des dernières générations (la plus récente en dernier)
+    std::uint64_t m_lastStepNanoseconds;    ///< Durée de la dernière itération
+    
+    /**
+     * @brief Réinitialise l'historique de détection des cycles à partir de la grille courante
+     */
+    void resetHistory();
 
 public:
     /**
@@ -41,6 +56,14 @@ public:
     int getMaxIterations() const { return m_maxIterations; }
     bool isRunning() const { return m_running; }
     const Rule& getRule() const { return *m_rule; }
+    const Grid& getPreviousGrid() const { return m_previousGrid; }
+    int getMaxPeriod() const { return m_maxPeriod; }
+    
+    /**
+     * @brief Période du cycle atteint (1 pour une grille stable)
+     * @return Période détectée, 0 si aucun cycle n'a été détecté
+     */
+    int getPeriod() const { return m_period; }
     
     /**
      * @brief Compte le nombre de cellules vivantes
@@ -48,6 +71,18 @@ public:
      */
     int countAliveCells() const;
     
+    /**
+     * @brief Durée de la dernière itération calculée par step()
+     * @return Durée en nanosecondes (0 avant la première itération)
+     */
+    std::uint64_t getLastStepNanoseconds() const { return m_lastStepNanoseconds; }
+    
+    /**
+     * @brief Estimation de la mémoire occupée par la grille, la grille précédente et l'historique
+     * @return Octets
+     */
+    size_t memoryBytes() const;
+    
     /**
      * @brief Réinitialise le compteur d'itérations
      */
@@ -56,6 +91,33 @@ public:
     // Setters
     void setMaxIterations(int max) { m_maxIterations = max; }
     void setParallel(bool parallel) { m_parallel = parallel; }
+    void setThreadCount(unsigned int threadCount) { m_threadCount = threadCount; }
+    unsigned int getThreadCount() const { return m_threadCount; }
+    void setBandRows(int bandRows) { m_bandRows = bandRows; }
+    int getBandRows() const { return m_bandRows; }
+    bool isParallel() const { return m_parallel; }
+    
+    /**
+     * @brief Applique la configuration du profil de réglage la plus proche de la grille courante
+     * 
+     * La densité est celle de la grille courante. Sans entrée pour cette topologie, la
+     * configuration actuelle est conservée.
+     * 
+     * @param profile Profil produit par AutoTuner (voir TuningProfile::loadDefault)
+     * @return true si une configuration a été appliquée
+     */
+    bool applyTuning(const TuningProfile& profile);
+    
+    /**
+     * @brief Active la détection des cycles (oscillateurs)
+     * 
+     * Les empreintes des maxPeriod dernières générations sont conservées ; la simulation
+     * se termine dès que la grille retrouve l'une d'elles. Les cycles de période > 1 sont
+     * détectés par empreinte 64 bits, sans comparaison complète des grilles.
+     * 
+     * @param maxPeriod Période maximale détectée (0 = désactivé, seule la stabilité arrête)
+     */
+    void setCycleDetection(int maxPeriod);
     
     /**
      * @brief Exécute une itération
@@ -64,7 +126,7 @@ public:
     bool step();
     
     /**
-     * @brief Vérifie si la simulation est terminée
+     * @brief Vérifie si la simulation est terminée (itérations, stabilité ou cycle détecté)
      * @return true si terminée
      */
     bool isFinished() const;
@@ -96,6 +158,22 @@ public:
      */
     void reset(std::unique_ptr<Grid> grid);
     
+    /**
+     * @brief Redémarre la simulation depuis la grille courante (itération 0)
+     * 
+     * Contrairement à reset(), la grille et sa mémoire sont conservées : la grille peut
+     * être remplie directement (fromCodes) puis la simulation relancée sans allocation.
+     */
+    void restart();
+    
+    /**
+     * @brief Restaure l'état complet d'une simulation (reprise sur point de contrôle)
+     * @param grid Grille courante
+     * @param previousGrid Grille de l'itération précédente (détection de stabilité)
+     * @param iteration Numéro d'itération
+     */
+    void restore(std::unique_ptr<Grid> grid, const Grid& previousGrid, int iteration);
+    
     /**
      * @brief Change les règles du jeu
      * @param rule Nouvelles règles
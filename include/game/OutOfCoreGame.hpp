@@ -0,0 +1,57 @@
+#ifndef OUTOFCOREGAME_HPP
+#define OUTOFCOREGAME_HPP
+
+#include <memory>
+#include "../grid/BandedGrid.hpp"
+#include "../rules/Rule.hpp"
+
+/**
+ * @brief Simulation hors mémoire sur une grille stockée par bandes
+ *
+ * Même interface et mêmes conditions d'arrêt que Game (nombre maximal d'itérations,
+ * stabilité), mais la grille reste sur disque : la stabilité est détectée pendant
+ * le calcul de la génération au lieu de comparer deux copies de la grille.
+ */
+class OutOfCoreGame {
+private:
+    std::unique_ptr<BandedGrid> m_grid;    ///< Grille stockée sur disque
+    std::unique_ptr<Rule> m_rule;          ///< Règles du jeu
+    int m_iteration;                       ///< Numéro d'itération actuel
+    int m_maxIterations;                   ///< Nombre maximum d'itérations (0 = infini)
+    bool m_stable;                         ///< La dernière génération n'a rien modifié
+
+public:
+    /**
+     * @brief Constructeur
+     * @param grid Grille initiale
+     * @param rule Règles du jeu
+     * @param maxIterations Nombre max d'itérations (0 = infini)
+     */
+    OutOfCoreGame(std::unique_ptr<BandedGrid> grid, std::unique_ptr<Rule> rule, int maxIterations = 0);
+
+    // Getters
+    const BandedGrid& getGrid() const { return *m_grid; }
+    BandedGrid& getGrid() { return *m_grid; }
+    int getIteration() const { return m_iteration; }
+    int getMaxIterations() const { return m_maxIterations; }
+    const Rule& getRule() const { return *m_rule; }
+    long long countAliveCells() const { return m_grid->countAliveCells(); }
+
+    /**
+     * @brief Exécute une itération
+     * @return true si la simulation continue, false si terminée
+     */
+    bool step();
+
+    /**
+     * @brief Vérifie si la simulation est terminée
+     */
+    bool isFinished() const;
+
+    /**
+     * @brief Vérifie si l'automate est stable (plus d'évolution)
+     */
+    bool isStable() const { return m_stable; }
+};
+
+#endif // OUTOFCOREGAME_HPP
@@ -0,0 +1,177 @@
+#ifndef SIMULATIONTHREAD_HPP
+#define SIMULATIONTHREAD_HPP
+
+#include "Game.hpp"
+#include "../util/TripleBuffer.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief État d'une génération publié par le thread de simulation
+ *
+ * Les tuiles modifiées sont celles qui diffèrent de la frame baseSequence : si
+ * l'interface l'a affichée, il lui suffit de redessiner ces tuiles.
+ */
+struct SimulationFrame {
+    /**
+     * @brief Côté (en cellules) des tuiles de dirtyTiles
+     */
+    static constexpr int TILE_SIZE = 32;
+
+    int width = 0;                          ///< Largeur de la grille
+    int height = 0;                         ///< Hauteur de la grille
+    bool toroidal = false;                  ///< Mode torique
+    bool parallel = false;                  ///< Calcul parallèle
+    bool running = false;                   ///< Simulation en cours
+    bool stable = false;                    ///< L'automate est stable
+    int iteration = 0;                      ///< Numéro d'itération
+    int population = 0;                     ///< Cellules vivantes
+    double generationsPerSecond = 0.0;      ///< Débit mesuré (0 à l'arrêt)
+    bool turbo = false;                     ///< Mode turbo actif
+    double stepMilliseconds = 0.0;          ///< Durée de la dernière génération calculée
+    size_t memoryBytes = 0;                 ///< Mémoire estimée de la grille (Game::memoryBytes)
+    std::vector<std::uint8_t> codes;        ///< Codes des cellules, ligne par ligne
+    std::uint64_t sequence = 0;             ///< Numéro de publication (1 pour la première)
+    std::uint64_t baseSequence = 0;         ///< Publication de référence de dirtyTiles
+    int tilesX = 0;                         ///< Tuiles par ligne
+    int tilesY = 0;                         ///< Lignes de tuiles
+    std::vector<std::uint8_t> dirtyTiles;   ///< 1 si la tuile a changé depuis baseSequence
+};
+
+/**
+ * @brief Exécute un Game sur un thread dédié, découplé de l'affichage
+ *
+ * Les générations sont publiées dans un triple tampon sans verrou : l'interface lit
+ * toujours la plus récente sans jamais bloquer la simulation, et inversement. Toute
+ * modification du jeu (clic, pattern, effacement, redimensionnement...) est envoyée sous
+ * forme de commande, exécutée entre deux générations sur le thread de simulation, qui est
+ * le seul à accéder au Game une fois démarré.
+ */
+class SimulationThread {
+public:
+    /**
+     * @brief Modification du jeu exécutée sur le thread de simulation
+     */
+    using Command = std::function<void(Game& game)>;
+
+private:
+    Game& m_game;                           ///< Jeu simulé (accédé uniquement par le thread)
+    TripleBuffer<SimulationFrame> m_frames; ///< Générations publiées
+    std::thread m_thread;                   ///< Thread de simulation
+    mutable std::mutex m_mutex;             ///< Protège la file de commandes
+    std::condition_variable m_wakeUp;       ///< Signale une commande ou l'arrêt
+    std::condition_variable m_idle;         ///< Signale que la file de commandes est vide
+    std::deque<Command> m_commands;         ///< Commandes en attente
+    size_t m_pending;                       ///< Commandes soumises non terminées
+    bool m_stopping;                        ///< Arrêt demandé
+    std::atomic<int> m_intervalMs;          ///< Intervalle minimal entre deux générations
+    std::atomic<bool> m_turbo;              ///< Générations enchaînées sans intervalle
+    std::atomic<int> m_turboRate;           ///< Débit visé en turbo (générations/s, 0 = maximal)
+    std::atomic<int> m_publishIntervalMs;   ///< Intervalle entre deux publications en turbo
+    double m_generationsPerSecond;          ///< Débit mesuré (thread de simulation)
+    std::string m_error;                    ///< Dernière erreur d'une commande
+    std::uint64_t m_sequence;               ///< Numéro de la dernière publication
+    std::vector<std::uint8_t> m_lastCodes;  ///< Codes de la dernière publication
+    int m_lastWidth;                        ///< Largeur de la dernière publication
+    std::uint64_t m_lastBase;               ///< Référence des tuiles de la dernière publication
+    std::vector<std::uint8_t> m_lastDirty;  ///< Tuiles modifiées de la dernière publication
+
+    /**
+     * @brief Boucle du thread : commandes, puis génération suivante quand elle est due
+     */
+    void run();
+
+    /**
+     * @brief Copie l'état du jeu dans le tampon du producteur et le publie
+     */
+    void publish();
+
+    /**
+     * @brief Marque les tuiles de la frame qui diffèrent de la dernière frame récupérée
+     *
+     * Si la publication précédente n'a pas été récupérée, elle sera remplacée : ses tuiles
+     * modifiées et sa référence sont reprises par la nouvelle frame.
+     */
+    void markDirtyTiles(SimulationFrame& frame);
+
+public:
+    /**
+     * @brief Démarre le thread (le jeu ne doit plus être utilisé directement ensuite)
+     * @param game Jeu à simuler
+     * @param intervalMs Intervalle minimal entre deux générations (ms)
+     */
+    explicit SimulationThread(Game& game, int intervalMs = 100);
+
+    /**
+     * @brief Destructeur : termine les commandes en attente puis arrête le thread
+     */
+    ~SimulationThread();
+
+    SimulationThread(const SimulationThread&) = delete;
+    SimulationThread& operator=(const SimulationThread&) = delete;
+
+    /**
+     * @brief Ajoute une commande (ne bloque pas) ; une génération est publiée après elle
+     */
+    void submit(Command command);
+
+    /**
+     * @brief Attend que toutes les commandes soumises soient exécutées et publiées
+     */
+    void flush();
+
+    /**
+     * @brief Change l'intervalle minimal entre deux générations (0 = au plus vite)
+     */
+    void setInterval(int intervalMs) { m_intervalMs.store(intervalMs, std::memory_order_relaxed); }
+    int getInterval() const { return m_intervalMs.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Mode turbo : les générations s'enchaînent au débit visé (0 = aussi vite que
+     *        possible) et seule la dernière de chaque intervalle de publication est publiée
+     * @param enabled Activer le turbo
+     * @param generationsPerSecond Débit visé (0 = maximal)
+     */
+    void setTurbo(bool enabled, int generationsPerSecond = 0) {
+        m_turboRate.store(generationsPerSecond, std::memory_order_relaxed);
+        m_turbo.store(enabled, std::memory_order_relaxed);
+    }
+    bool isTurbo() const { return m_turbo.load(std::memory_order_relaxed); }
+    int getTurboRate() const { return m_turboRate.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Intervalle entre deux publications en turbo (budget d'une image, 16 ms par défaut)
+     */
+    void setPublishInterval(int intervalMs) { m_publishIntervalMs.store(intervalMs, std::memory_order_relaxed); }
+
+    /**
+     * @brief Vrai si aucune commande n'est en attente et que la dernière génération publiée
+     *        a été récupérée : rien ne changera sans nouvelle commande (simulation à l'arrêt)
+     */
+    bool isIdle() const;
+
+    /**
+     * @brief Récupère la dernière génération publiée (thread de l'interface)
+     * @return true si elle est plus récente que celle de getFrame()
+     */
+    bool fetchFrame() { return m_frames.fetch(); }
+
+    /**
+     * @brief Dernière génération récupérée par fetchFrame()
+     */
+    const SimulationFrame& getFrame() const { return m_frames.front(); }
+
+    /**
+     * @brief Retourne et efface la dernière erreur levée par une commande
+     */
+    std::string takeError();
+};
+
+#endif // SIMULATIONTHREAD_HPP
@@ -0,0 +1,102 @@
+#ifndef SOUPRUNNER_HPP
+#define SOUPRUNNER_HPP
+
+#include <vector>
+#include <map>
+#include <functional>
+#include <cstdint>
+
+/**
+ * @brief Paramètres d'un ensemble de soupes aléatoires
+ */
+struct SoupOptions {
+    int width = 32;                     ///< Largeur des grilles
+    int height = 32;                    ///< Hauteur des grilles
+    double density = 0.5;               ///< Probabilité qu'une cellule soit vivante
+    std::uint64_t seed = 1;             ///< Graine commune
+    long long count = 1000;             ///< Nombre de soupes
+    int maxGenerations = 10000;         ///< Générations maximales par soupe
+    int maxPeriod = 64;                 ///< Période maximale des cycles détectés
+    bool toroidal = false;              ///< Mode torique
+    unsigned int threadCount = 0;       ///< Nombre de threads (0 = nombre de cœurs)
+};
+
+/**
+ * @brief Résultat d'une soupe
+ */
+struct SoupResult {
+    long long index = 0;                ///< Numéro de la soupe
+    int initialPopulation = 0;          ///< Cellules vivantes au départ
+    int finalGeneration = 0;            ///< Génération à laquelle le cycle final a été détecté
+    int lifespan = 0;                   ///< Première génération du cycle final (maxGenerations si aucun)
+    int finalPopulation = 0;            ///< Cellules vivantes à la fin
+    int period = 0;                     ///< Période du cycle final (1 = stable, 0 = aucun)
+};
+
+/**
+ * @brief Statistiques agrégées d'un ensemble de soupes
+ */
+struct SoupStatistics {
+    long long soups = 0;                        ///< Soupes simulées
+    long long settled = 0;                      ///< Soupes ayant atteint un cycle
+    long long lifespanSum = 0;                  ///< Somme des durées de vie (soupes stabilisées)
+    long long finalPopulationSum = 0;           ///< Somme des populations finales
+    int maxLifespan = -1;                       ///< Plus longue durée de vie
+    long long maxLifespanSoup = -1;             ///< Soupe ayant la plus longue durée de vie
+    std::map<int, long long> periodCounts;      ///< Nombre de soupes par période finale (0 = aucune)
+
+    /**
+     * @brief Ajoute le résultat d'une soupe
+     */
+    void add(const SoupResult& result);
+
+    /**
+     * @brief Fusionne les statistiques d'un autre thread
+     */
+    void merge(const SoupStatistics& other);
+
+    double meanLifespan() const { return settled > 0 ? static_cast<double>(lifespanSum) / settled : 0.0; }
+    double meanFinalPopulation() const { return soups > 0 ? static_cast<double>(finalPopulationSum) / soups : 0.0; }
+};
+
+/**
+ * @brief Simule un grand nombre de soupes aléatoires jusqu'à stabilisation
+ *
+ * La soupe i est générée par un générateur à compteur (graine, i) : elle est identique
+ * quel que soit le thread qui la simule. Chaque thread garde sa propre grille et son propre
+ * Game, réutilisés d'une soupe à l'autre sans réallocation des cellules.
+ */
+class SoupRunner {
+public:
+    /**
+     * @brief Fonction appelée à la fin de chaque soupe (appels sérialisés, ordre quelconque)
+     */
+    using ResultCallback = std::function<void(const SoupResult& result)>;
+
+private:
+    SoupOptions m_options;
+
+public:
+    /**
+     * @brief Constructeur
+     * @param options Paramètres de l'ensemble
+     * @throw std::invalid_argument si les paramètres sont invalides
+     */
+    explicit SoupRunner(const SoupOptions& options);
+
+    /**
+     * @brief Génère les codes initiaux d'une soupe
+     * @param index Numéro de la soupe
+     * @param codes Codes ligne par ligne (redimensionné si nécessaire)
+     */
+    void generateSoup(long long index, std::vector<std::uint8_t>& codes) const;
+
+    /**
+     * @brief Simule toutes les soupes
+     * @param onResult Fonction appelée pour chaque soupe (optionnelle)
+     * @return Statistiques agrégées
+     */
+    SoupStatistics run(const ResultCallback& onResult = nullptr) const;
+};
+
+#endif // SOUPRUNNER_HPP
@@ -0,0 +1,121 @@
+#ifndef BANDEDGRID_HPP
+#define BANDEDGRID_HPP
+
+#include <string>
+#include <vector>
+#include <fstream>
+#include <functional>
+#include <cstdint>
+#include "../rules/Rule.hpp"
+
+/**
+ * @brief Grille stockée sur disque par bandes de lignes compactées (simulation hors mémoire)
+ *
+ * Chaque ligne est stockée sous forme de deux plans de bits (vivant, obstacle).
+ * La grille courante et la grille suivante sont deux fichiers distincts, échangés à
+ * chaque génération. Le calcul ne garde en mémoire qu'une fenêtre glissante de trois
+ * bandes (précédente, courante, suivante) ; la bande d'après est lue de façon asynchrone
+ * pendant le calcul de la bande courante, et les résultats sont écrits en arrière-plan.
+ */
+class BandedGrid {
+public:
+    /**
+     * @brief Fonction remplissant les codes d'une ligne (0 mort, 1 vivant, 2 obstacle mort, 3 obstacle vivant)
+     */
+    using RowFiller = std::function<void(int y, std::uint8_t* rowCodes)>;
+
+    /**
+     * @brief Fonction recevant les codes d'une ligne
+     */
+    using RowSink = std::function<void(int y, const std::uint8_t* rowCodes)>;
+
+private:
+    std::string m_basePath;             ///< Préfixe des fichiers de stockage
+    int m_width;                        ///< Largeur de la grille
+    int m_height;                       ///< Hauteur de la grille
+    bool m_toroidal;                    ///< Mode torique activé
+    int m_bandRows;                     ///< Nombre de lignes par bande
+    int m_bandCount;                    ///< Nombre de bandes
+    size_t m_wordsPerRow;               ///< Mots de 64 bits par plan de bits d'une ligne
+    mutable std::fstream m_files[2];    ///< Fichiers de la génération courante et suivante
+    int m_current;                      ///< Index du fichier de la génération courante
+    long long m_population;             ///< Nombre de cellules vivantes
+    bool m_lastStepChanged;             ///< La dernière génération a modifié au moins une cellule
+
+    /**
+     * @brief Nombre de lignes d'une bande (la dernière peut être incomplète)
+     */
+    int rowsInBand(int band) const;
+
+    /**
+     * @brief Lit une bande depuis un fichier
+     */
+    std::vector<std::uint64_t> readBand(int file, int band) const;
+
+    /**
+     * @brief Écrit une bande dans un fichier
+     */
+    void writeBand(int file, int band, const std::vector<std::uint64_t>& data);
+
+    /**
+     * @brief Lit une seule ligne depuis un fichier
+     */
+    std::vector<std::uint64_t> readRow(int file, int y) const;
+
+    /**
+     * @brief Calcule une ligne de la génération suivante sur les plans de bits
+     * @return true si au moins une cellule a changé
+     */
+    bool computeRow(const std::uint64_t* above, const std::uint64_t* row, const std::uint64_t* below,
+                    std::uint64_t* out, const bool birth[9], const bool survive[9], long long& population) const;
+
+public:
+    /**
+     * @brief Constructeur : crée les fichiers de stockage (grille entièrement morte)
+     * @param basePath Préfixe des fichiers de stockage (deux fichiers .band0 et .band1)
+     * @param width Largeur de la grille
+     * @param height Hauteur de la grille
+     * @param toroidal Active le mode torique
+     * @param bandRows Nombre de lignes par bande
+     * @throw std::runtime_error si les fichiers ne peuvent pas être créés
+     */
+    BandedGrid(const std::string& basePath, int width, int height, bool toroidal = false, int bandRows = 256);
+
+    /**
+     * @brief Destructeur : supprime les fichiers de stockage
+     */
+    ~BandedGrid();
+
+    BandedGrid(const BandedGrid&) = delete;
+    BandedGrid& operator=(const BandedGrid&) = delete;
+
+    // Getters
+    int getWidth() const { return m_width; }
+    int getHeight() const { return m_height; }
+    bool isToroidal() const { return m_toroidal; }
+    int getBandRows() const { return m_bandRows; }
+    int getBandCount() const { return m_bandCount; }
+    long long countAliveCells() const { return m_population; }
+    bool lastStepChanged() const { return m_lastStepChanged; }
+
+    /**
+     * @brief Remplit toute la grille ligne par ligne, dans l'ordre, bande par bande
+     * @param filler Fonction produisant les codes de chaque ligne
+     */
+    void importRows(const RowFiller& filler);
+
+    /**
+     * @brief Parcourt toute la grille ligne par ligne, dans l'ordre
+     * @param sink Fonction recevant les codes de chaque ligne
+     */
+    void exportRows(const RowSink& sink) const;
+
+    /**
+     * @brief Calcule la génération suivante en parcourant les bandes
+     * @param rule Règles à appliquer
+     * @return true si au moins une cellule a changé
+     */
+    bool step(const Rule& rule);
+};
+
+#endif // BANDEDGRID_HPP
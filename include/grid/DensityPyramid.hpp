@@ -0,0 +1,88 @@
+#ifndef DENSITYPYRAMID_HPP
+#define DENSITYPYRAMID_HPP
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+/**
+ * @brief Pyramide multi-résolution de la densité de cellules vivantes
+ *
+ * Le niveau k résume des blocs de 2^k x 2^k cellules : chaque valeur (0 à 255) est la
+ * proportion de cellules vivantes du bloc. Le niveau 1 est calculé à partir des codes des
+ * cellules, chaque niveau suivant moyenne les 2x2 blocs du niveau inférieur. Les blocs
+ * débordant de la grille comptent les cellules absentes comme mortes.
+ *
+ * Après une modification, seuls les blocs couvrant la région modifiée sont recalculés,
+ * à chaque niveau.
+ */
+class DensityPyramid {
+private:
+    int m_width;                                    ///< Largeur de la grille (cellules)
+    int m_height;                                   ///< Hauteur de la grille (cellules)
+    std::vector<std::vector<std::uint8_t>> m_levels; ///< m_levels[k - 1] = niveau k, ligne par ligne
+
+    /**
+     * @brief Recalcule les blocs [x0, x1] x [y0, y1] du niveau 1
+     */
+    void computeFirstLevel(const std::uint8_t* codes, int x0, int y0, int x1, int y1);
+
+    /**
+     * @brief Recalcule les blocs [x0, x1] x [y0, y1] du niveau level (> 1)
+     */
+    void computeLevel(int level, int x0, int y0, int x1, int y1);
+
+public:
+    DensityPyramid();
+
+    /**
+     * @brief Reconstruit toute la pyramide
+     * @param codes Codes des cellules ligne par ligne (bit 0 = vivante)
+     * @param width Largeur de la grille
+     * @param height Hauteur de la grille
+     */
+    void rebuild(const std::uint8_t* codes, int width, int height);
+
+    /**
+     * @brief Met à jour les blocs couvrant une région modifiée
+     * @param codes Codes de toute la grille (mêmes dimensions qu'au dernier rebuild)
+     * @param x Colonne de la région
+     * @param y Ligne de la région
+     * @param width Largeur de la région
+     * @param height Hauteur de la région
+     */
+    void update(const std::uint8_t* codes, int x, int y, int width, int height);
+
+    /**
+     * @brief Nombre de niveaux (le dernier tient en un seul bloc)
+     */
+    int getLevelCount() const { return static_cast<int>(m_levels.size()); }
+
+    /**
+     * @brief Dimensions du niveau level (1 à getLevelCount())
+     */
+    int getLevelWidth(int level) const { return (m_width + (1 << level) - 1) >> level; }
+    int getLevelHeight(int level) const { return (m_height + (1 << level) - 1) >> level; }
+
+    /**
+     * @brief Densités du niveau level, ligne par ligne
+     */
+    const std::uint8_t* getLevel(int level) const { return m_levels[level - 1].data(); }
+
+    /**
+     * @brief Densité (0 à 255) du bloc (x, y) du niveau level
+     */
+    std::uint8_t getDensity(int level, int x, int y) const {
+        return m_levels[level - 1][static_cast<size_t>(y) * getLevelWidth(level) + x];
+    }
+
+    int getWidth() const { return m_width; }
+    int getHeight() const { return m_height; }
+
+    /**
+     * @brief Mémoire occupée par les niveaux (octets)
+     */
+    size_t memoryBytes() const;
+};
+
+#endif // DENSITYPYRAMID_HPP
@@ -4,6 +4,7 @@
 #include <vector>
 #include <memory>
 #include <functional>
+#include <cstdint>
 #include "../cell/Cell.hpp"
 #include "../rules/Rule.hpp"
 
@@ -19,6 +20,7 @@ private:
     int m_height;                          ///< Hauteur de la grille
     bool m_toroidal;                       ///< Mode torique activé
     std::vector<std::vector<std::unique_ptr<Cell>>> m_cells; ///< Matrice de cellules
+    std::vector<std::uint8_t> m_neighborCounts; ///< Voisins comptés par update() quand les métriques sont actives
 
     /**
      * @brief Normalise une coordonnée pour le mode torique
@@ -37,6 +39,20 @@ public:
      */
     Grid(int width, int height, bool toroidal = false);
     
+    /**
+     * @brief Constructeur à partir des codes de cellules
+     * 
+     * Chaque cellule est créée directement dans son état final (une seule allocation),
+     * les lignes étant construites en parallèle pour les grandes grilles.
+     * 
+     * @param width Largeur de la grille
+     * @param height Hauteur de la grille
+     * @param codes Codes ligne par ligne (0 mort, 1 vivant, 2 obstacle mort, 3 obstacle vivant)
+     * @param toroidal Active le mode torique
+     * @throw std::invalid_argument si les dimensions ou un code sont invalides
+     */
+    Grid(int width, int height, const std::vector<std::uint8_t>& codes, bool toroidal = false);
+    
     /**
      * @brief Constructeur de copie
      */
@@ -44,6 +60,9 @@ public:
     
     /**
      * @brief Opérateur d'affectation
+     * 
+     * À dimensions égales, les cellules existantes sont réutilisées : seuls les états
+     * qui diffèrent sont remplacés (les états suivants en attente ne sont pas copiés).
      */
     Grid& operator=(const Grid& other);
     
@@ -83,8 +102,11 @@ public:
      * @brief Met à jour la grille selon les règles données
      * @param rule Règles à appliquer
      * @param parallel Utiliser le calcul parallèle
+     * @param threadCount Nombre de threads en mode parallèle (0 = nombre de cœurs)
+     * @param bandRows Lignes par bande distribuée dynamiquement aux threads
+     *                 (0 = une bande contiguë par thread)
      */
-    void update(const Rule& rule, bool parallel = false);
+    void update(const Rule& rule, bool parallel = false, unsigned int threadCount = 0, int bandRows = 0);
     
     /**
      * @brief Vérifie si une position est valide
@@ -101,6 +123,18 @@ public:
      */
     bool equals(const Grid& other) const;
     
+    /**
+     * @brief Empreinte de l'état vivant/mort des cellules (même critère que equals)
+     * @return Empreinte FNV-1a 64 bits
+     */
+    std::uint64_t hash() const;
+    
+    /**
+     * @brief Estimation de la mémoire occupée par les cellules et leurs états
+     * @return Octets (hors surcoût de l'allocateur)
+     */
+    size_t memoryBytes() const;
+    
     /**
      * @brief Active/désactive le mode torique
      * @param toroidal État du mode torique
@@ -120,6 +154,25 @@ public:
      * @param startY Position Y de départ
      */
     void placePattern(const std::vector<std::vector<bool>>& pattern, int startX, int startY);
+    
+    /**
+     * @brief Exporte l'état de toutes les cellules sous forme de codes
+     * @return Codes ligne par ligne (0 mort, 1 vivant, 2 obstacle mort, 3 obstacle vivant)
+     */
+    std::vector<std::uint8_t> toCodes() const;
+    
+    /**
+     * @brief Exporte les codes dans un tampon existant (réutilise sa capacité)
+     * @param codes Tampon redimensionné à largeur x hauteur
+     */
+    void toCodes(std::vector<std::uint8_t>& codes) const;
+    
+    /**
+     * @brief Remplace l'état de toutes les cellules à partir de codes
+     * @param codes Codes ligne par ligne (taille largeur x hauteur)
+     * @throw std::invalid_argument si la taille ou un code est invalide
+     */
+    void fromCodes(const std::vector<std::uint8_t>& codes);
 };
 
 #endif // GRID_HPP
@@ -0,0 +1,224 @@
+#ifndef QUADTREE_HPP
+#define QUADTREE_HPP
+
+#include <vector>
+#include <memory>
+#include <unordered_map>
+#include <cstdint>
+#include "Grid.hpp"
+
+/**
+ * @brief Grille représentée par un arbre quaternaire canonique (sous-arbres partagés)
+ *
+ * Chaque nœud couvre un carré de 2^niveau cellules de côté. Les feuilles (niveau 3)
+ * sont des blocs 8x8 stockés sous forme de deux plans de bits (vivant, obstacle).
+ * Les nœuds sont uniques : deux sous-arbres identiques sont représentés par le même
+ * nœud, si bien qu'un motif très grand mais régulier n'occupe que quelques nœuds.
+ * Le nœud 0 représente un carré vide, quel que soit son niveau.
+ *
+ * La grille est une fenêtre width x height de la racine, commençant à (originX, originY).
+ */
+class QuadTree {
+public:
+    using NodeId = std::uint32_t;
+
+    static constexpr NodeId EMPTY = 0;      ///< Nœud vide (tous niveaux)
+    static constexpr int LEAF_LEVEL = 3;    ///< Niveau des feuilles (blocs 8x8)
+    static constexpr int MAX_LEVEL = 62;    ///< Niveau maximal de la racine
+
+private:
+    /**
+     * @brief Nœud de l'arbre (feuille : plans de bits, sinon : quatre enfants)
+     */
+    struct Node {
+        int level;                      ///< Niveau du nœud
+        NodeId children[4];             ///< Enfants nw, ne, sw, se (nœuds internes)
+        std::uint64_t alive;            ///< Plan des cellules vivantes (feuilles, bit = y * 8 + x)
+        std::uint64_t obstacle;         ///< Plan des obstacles (feuilles)
+        long long population;           ///< Nombre de cellules vivantes du sous-arbre
+        bool hasObstacles;              ///< Le sous-arbre contient au moins un obstacle
+    };
+
+    /**
+     * @brief Clé de déduplication (deux mots de 64 bits)
+     */
+    struct Key {
+        std::uint64_t a;
+        std::uint64_t b;
+        bool operator==(const Key& other) const { return a == other.a && b == other.b; }
+    };
+
+    struct KeyHash {
+        size_t operator()(const Key& key) const {
+            return static_cast<size_t>((key.a * 0x9E3779B97F4A7C15ULL) ^ (key.b + 0x632BE59BD9B4E019ULL + (key.a >> 29)));
+        }
+    };
+
+    std::vector<Node> m_nodes;                                  ///< Nœuds (le nœud 0 est vide)
+    std::unordered_map<Key, NodeId, KeyHash> m_leafIndex;       ///< Feuilles déjà créées
+    std::unordered_map<Key, NodeId, KeyHash> m_nodeIndex;       ///< Nœuds internes déjà créés
+    NodeId m_root;                      ///< Racine
+    int m_rootLevel;                    ///< Niveau de la racine
+    long long m_originX;                ///< Abscisse de la fenêtre dans la racine
+    long long m_originY;                ///< Ordonnée de la fenêtre dans la racine
+    int m_width;                        ///< Largeur de la fenêtre
+    int m_height;                       ///< Hauteur de la fenêtre
+
+    /**
+     * @brief Remplit une portion de ligne à partir d'un sous-arbre
+     */
+    void fillRow(NodeId id, int level, long long nodeX, long long y,
+                 long long fromX, long long toX, std::uint8_t* rowCodes) const;
+
+public:
+    /**
+     * @brief Constructeur : arbre vide couvrant une grille width x height
+     * @param width Largeur de la grille
+     * @param height Hauteur de la grille
+     * @throw std::invalid_argument si les dimensions ne sont pas positives
+     */
+    QuadTree(int width, int height);
+
+    /**
+     * @brief Crée (ou retrouve) une feuille 8x8
+     * @param alive Plan des cellules vivantes (bit = y * 8 + x)
+     * @param obstacle Plan des obstacles
+     * @return Identifiant de la feuille (EMPTY si vide)
+     */
+    NodeId makeLeaf(std::uint64_t alive, std::uint64_t obstacle);
+
+    /**
+     * @brief Crée (ou retrouve) un nœud interne
+     * @param level Niveau du nœud (> LEAF_LEVEL)
+     * @param nw Enfant nord-ouest
+     * @param ne Enfant nord-est
+     * @param sw Enfant sud-ouest
+     * @param se Enfant sud-est
+     * @return Identifiant du nœud (EMPTY si les quatre enfants sont vides)
+     * @throw std::invalid_argument si un enfant n'a pas le niveau attendu
+     */
+    NodeId makeNode(int level, NodeId nw, NodeId ne, NodeId sw, NodeId se);
+
+    /**
+     * @brief Définit la racine
+     * @param root Racine
+     * @param level Niveau de la racine
+     * @throw std::invalid_argument si la racine n'a pas ce niveau ou si la fenêtre dépasse
+     */
+    void setRoot(NodeId root, int level);
+
+    /**
+     * @brief Définit la fenêtre de la grille dans la racine
+     * @param originX Abscisse de la fenêtre
+     * @param originY Ordonnée de la fenêtre
+     * @param width Largeur de la grille
+     * @param height Hauteur de la grille
+     * @throw std::invalid_argument si la fenêtre dépasse de la racine
+     */
+    void setWindow(long long originX, long long originY, int width, int height);
+
+    /**
+     * @brief Réduit la fenêtre au plus petit rectangle contenant des cellules non mortes
+     * @return false si l'arbre est vide (la fenêtre est alors inchangée)
+     * @throw std::runtime_error si le rectangle dépasse la taille maximale d'une grille
+     */
+    bool cropToContent();
+
+    // Getters
+    int getWidth() const { return m_width; }
+    int getHeight() const { return m_height; }
+    NodeId getRoot() const { return m_root; }
+    int getRootLevel() const { return m_rootLevel; }
+    long long getOriginX() const { return m_originX; }
+    long long getOriginY() const { return m_originY; }
+    size_t getNodeCount() const { return m_nodes.size() - 1; }
+    long long countAliveCells() const { return m_nodes[m_root].population; }
+    bool hasObstacles() const { return m_nodes[m_root].hasObstacles; }
+
+    /**
+     * @brief Accès aux nœuds (parcours pour l'export)
+     */
+    bool isLeaf(NodeId id) const { return m_nodes[id].level == LEAF_LEVEL; }
+    const NodeId* getChildren(NodeId id) const { return m_nodes[id].children; }
+    std::uint64_t getLeafAlive(NodeId id) const { return m_nodes[id].alive; }
+    std::uint64_t getLeafObstacle(NodeId id) const { return m_nodes[id].obstacle; }
+
+    /**
+     * @brief Remplit les codes d'une ligne de la grille (0 mort, 1 vivant, 2 obstacle mort, 3 obstacle vivant)
+     * @param y Ligne de la grille
+     * @param rowCodes Tableau de getWidth() codes
+     */
+    void fillRow(int y, std::uint8_t* rowCodes) const;
+
+    /**
+     * @brief Construit la grille dense correspondante
+     * @param toroidal Mode torique
+     * @return Nouvelle grille
+     */
+    std::unique_ptr<Grid> toGrid(bool toroidal = false) const;
+};
+
+/**
+ * @brief Construction incrémentale d'un QuadTree, ligne par ligne
+ *
+ * Seules les lignes de la bande de 8 en cours et une rangée de nœuds par niveau sont
+ * gardées en mémoire : une grille peut être convertie sans être entièrement chargée.
+ */
+class QuadTreeBuilder {
+private:
+    std::unique_ptr<QuadTree> m_tree;               ///< Arbre en construction
+    int m_width;                                    ///< Largeur de la grille
+    int m_height;                                   ///< Hauteur de la grille
+    int m_rootLevel;                                ///< Niveau de la racine
+    int m_nextRow;                                  ///< Prochaine ligne attendue
+    std::vector<std::uint64_t> m_alive;             ///< Plans vivants des feuilles de la bande en cours
+    std::vector<std::uint64_t> m_obstacle;          ///< Plans d'obstacles des feuilles de la bande en cours
+    std::vector<std::vector<QuadTree::NodeId>> m_pending;   ///< Rangée de nœuds en attente par niveau
+    std::vector<bool> m_hasPending;                 ///< Une rangée est en attente à ce niveau
+
+    /**
+     * @brief Ajoute une rangée de nœuds d'un niveau (fusion avec la rangée en attente)
+     */
+    void pushRow(int level, std::vector<QuadTree::NodeId> row);
+
+    /**
+     * @brief Fusionne deux rangées de nœuds d'un niveau en une rangée du niveau supérieur
+     */
+    std::vector<QuadTree::NodeId> mergeRows(int level, const std::vector<QuadTree::NodeId>& top,
+                                            const std::vector<QuadTree::NodeId>& bottom);
+
+    /**
+     * @brief Termine la bande de 8 lignes en cours
+     */
+    void flushStrip();
+
+public:
+    /**
+     * @brief Constructeur
+     * @param width Largeur de la grille
+     * @param height Hauteur de la grille
+     */
+    QuadTreeBuilder(int width, int height);
+
+    /**
+     * @brief Ajoute la ligne suivante
+     * @param rowCodes Codes des getWidth() cellules de la ligne
+     * @throw std::logic_error si toutes les lignes ont déjà été ajoutées
+     */
+    void addRow(const std::uint8_t* rowCodes);
+
+    /**
+     * @brief Termine la construction (les lignes manquantes sont mortes)
+     * @return Arbre construit
+     */
+    std::unique_ptr<QuadTree> finish();
+
+    /**
+     * @brief Construit l'arbre d'une grille dense
+     * @param grid Grille source
+     * @return Arbre construit
+     */
+    static std::unique_ptr<QuadTree> fromGrid(const Grid& grid);
+};
+
+#endif // QUADTREE_HPP
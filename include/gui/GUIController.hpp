@@ -3,7 +3,9 @@
 
 #include <SFML/Graphics.hpp>
 #include "../game/Game.hpp"
+#include "../game/SimulationThread.hpp"
 #include "../patterns/Patterns.hpp"
+#include "../io/AsyncWriter.hpp"
 #include "GUIRenderer.hpp"
 #include <memory>
 
@@ -12,23 +14,58 @@
  * 
  * Gère les interactions utilisateur et coordonne le jeu et le rendu.
  * Séparation des responsabilités : logique de contrôle uniquement.
+ * 
+ * La simulation tourne sur son propre thread (SimulationThread) : l'affichage dessine la
+ * dernière génération publiée et les actions de l'utilisateur sont envoyées au jeu sous
+ * forme de commandes. Une génération lente ne bloque ni les entrées ni le rendu.
  */
 class GUIController {
 private:
     sf::RenderWindow m_window;         ///< Fenêtre SFML
-    Game& m_game;                       ///< Référence au jeu
     GUIRenderer m_renderer;             ///< Renderer graphique
-    sf::Clock m_clock;                  ///< Horloge pour le timing
     int m_updateInterval;               ///< Intervalle entre mises à jour (ms)
+    int m_turboRateIndex;               ///< Débit visé en turbo (index dans TURBO_RATES)
     bool m_showHelp;                    ///< Afficher l'aide
     std::string m_selectedPattern;      ///< Pattern sélectionné
     int m_patternIndex;                 ///< Index du pattern actuel
     bool m_parallel;                    ///< Mode parallèle
-    std::unique_ptr<Grid> m_initialGrid; ///< Copie de la grille initiale pour reset
+    std::unique_ptr<Grid> m_initialGrid; ///< Copie de la grille initiale pour reset (thread de simulation)
     std::string m_saveFilename;         ///< Nom du fichier pour sauvegarde
     int m_saveCounter;                  ///< Compteur pour les sauvegardes
+    AsyncWriter m_saveWriter;           ///< Écriture des sauvegardes en arrière-plan
+    std::string m_pendingSave;          ///< Dernière sauvegarde en cours (vide si aucune)
+    bool m_panning;                     ///< Déplacement de la vue en cours (clic milieu)
+    int m_panStartX;                    ///< Position de la souris au début du déplacement
+    int m_panStartY;
+    int m_panCameraX;                   ///< Caméra au début du déplacement
+    int m_panCameraY;
+    bool m_needsRedraw;                 ///< L'affichage a changé depuis la dernière image
+    bool m_showPerf;                    ///< Afficher le panneau de performances
+    GUIRenderer::PerfStats m_perf;      ///< Mesures du panneau de performances
+    FrameHistory m_frameTimes;          ///< Durées des dernières images (ms)
+    sf::Clock m_frameClock;             ///< Temps depuis la dernière image
+    bool m_frameClockValid;             ///< Faux après une attente d'événement (durée non significative)
+    sf::Clock m_fpsClock;               ///< Début de la mesure d'images par seconde
+    int m_fpsFrames;                    ///< Images dessinées depuis m_fpsClock
+    SimulationThread m_simulation;      ///< Thread de simulation (démarré en dernier)
 
 public:
+    /**
+     * @brief Côté maximal de la grille (la vue n'affiche que la partie visible)
+     */
+    static constexpr int MAX_GRID_SIZE = 100000;
+
+    /**
+     * @brief Attente (ms) entre deux vérifications quand la simulation tourne sans nouvelle image
+     */
+    static constexpr int IDLE_POLL_MS = 4;
+
+    /**
+     * @brief Débits proposés en turbo, du plus rapide au plus lent (générations/s, 0 = maximal)
+     */
+    static constexpr int TURBO_RATES[] = {0, 10000, 5000, 2000, 1000, 500, 200, 100};
+    static constexpr int TURBO_RATE_COUNT = sizeof(TURBO_RATES) / sizeof(TURBO_RATES[0]);
+
     /**
      * @brief Constructeur
      * @param game Référence au jeu
@@ -42,15 +79,34 @@ public:
      * @brief Boucle principale
      */
     void run();
+    
+    /**
+     * @brief Active le mode turbo : autant de générations que possible entre deux images
+     * @param generationsPerSecond Débit visé (0 = maximal), arrondi au débit proposé le plus proche
+     */
+    void enableTurbo(int generationsPerSecond = 0);
 
 private:
     /**
-     * @brief Gère les événements utilisateur
+     * @brief Gère les événements utilisateur en attente
      */
     void handleEvents();
     
     /**
-     * @brief Met à jour la simulation
+     * @brief Traite un événement (l'image est à redessiner sauf pour un simple mouvement de souris)
+     */
+    void handleEvent(const sf::Event& event);
+    
+    /**
+     * @brief Vrai si rien ne peut changer sans action de l'utilisateur : simulation à l'arrêt,
+     *        aucune commande ni génération en attente, aucune sauvegarde en cours
+     */
+    bool isIdle() const;
+    
+    /**
+     * @brief Récupère la dernière génération publiée par le thread de simulation
+     * 
+     * Marque l'image à redessiner si une nouvelle génération est arrivée.
      */
     void update();
     
@@ -71,6 +127,19 @@ private:
      */
     void handleMouseClick(const sf::Event& event);
     
+    /**
+     * @brief Déplace la vue pendant un glisser au clic milieu
+     * @param event Événement souris
+     */
+    void handleMouseMove(const sf::Event& event);
+    
+    /**
+     * @brief Déplace la vue d'un quart de sa taille
+     * @param columns Sens horizontal (-1, 0 ou 1)
+     * @param rows Sens vertical (-1, 0 ou 1)
+     */
+    void panView(int columns, int rows);
+    
     /**
      * @brief Place le pattern sélectionné
      * @param gridX Position X sur la grille
@@ -100,9 +169,17 @@ private:
     
     /**
      * @brief Sauvegarde l'état actuel dans un fichier
+     * 
+     * Les codes de la génération affichée sont copiés, puis formatés et écrits sur le
+     * thread de sauvegarde : l'interface ne se fige pas, même pour une grande grille.
      */
     void saveCurrentState();
     
+    /**
+     * @brief Affiche le résultat des sauvegardes terminées
+     */
+    void checkSaveStatus();
+    
     /**
      * @brief Gère la molette de souris (zoom)
      * @param event Événement souris
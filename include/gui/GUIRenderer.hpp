@@ -3,7 +3,12 @@
 
 #include <SFML/Graphics.hpp>
 #include "../grid/Grid.hpp"
+#include "../game/SimulationThread.hpp"
+#include "../grid/DensityPyramid.hpp"
+#include "../util/FrameHistory.hpp"
 #include <string>
+#include <vector>
+#include <cstdint>
 
 /**
  * @brief Classe responsable du rendu graphique de la grille
@@ -26,8 +31,104 @@ private:
     int m_offsetX;                      ///< Décalage X pour le panneau latéral
     int m_offsetY;                      ///< Décalage Y pour le panneau info
     int m_panelWidth;                   ///< Largeur du panneau latéral
+    int m_cameraX;                      ///< Première colonne visible
+    int m_cameraY;                      ///< Première ligne visible
+    sf::Texture m_gridTexture;          ///< Partie visible de la grille, un texel par cellule
+    sf::Sprite m_gridSprite;            ///< Texture agrandie à la taille des cellules
+    std::vector<sf::Uint8> m_pixels;    ///< Pixels RGBA envoyés à la texture
+    std::uint64_t m_textureSequence;    ///< Publication contenue dans la texture (0 = aucune)
+    int m_textureX;                     ///< Colonne de la grille au coin de la texture
+    int m_textureY;                     ///< Ligne de la grille au coin de la texture
+    int m_lodLevel;                     ///< Niveau de densité affiché (0 = cellules)
+    DensityPyramid m_pyramid;           ///< Densités multi-résolution (vue dézoomée)
+    std::uint64_t m_pyramidSequence;    ///< Publication contenue dans la pyramide (0 = aucune)
+
+    /**
+     * @brief Valeurs affichées par le panneau d'information
+     */
+    struct InfoValues {
+        int iteration, running, speed, toroidal, parallel, aliveCells, stable;
+        int gridWidth, gridHeight, cameraX, cameraY, cellSize, lodLevel;
+        int turbo, turboRate, generationsPerSecond;
+
+        bool operator==(const InfoValues& other) const {
+            return iteration == other.iteration && running == other.running && speed == other.speed &&
+                   toroidal == other.toroidal && parallel == other.parallel &&
+                   aliveCells == other.aliveCells && stable == other.stable &&
+                   gridWidth == other.gridWidth && gridHeight == other.gridHeight &&
+                   cameraX == other.cameraX && cameraY == other.cameraY &&
+                   cellSize == other.cellSize && lodLevel == other.lodLevel &&
+                   turbo == other.turbo && turboRate == other.turboRate &&
+                   generationsPerSecond == other.generationsPerSecond;
+        }
+    };
+
+    // Panneaux : le contenu statique est dessiné une fois dans une texture, les textes
+    // dynamiques ne sont recomposés que lorsque leurs valeurs changent
+    sf::RectangleShape m_infoBackground;    ///< Fond du panneau d'information
+    sf::Text m_infoText;                    ///< Génération, population, grille, état
+    sf::Text m_optionsText;                 ///< Options, vitesse et zoom
+    sf::Text m_quickHelpText;               ///< Raccourcis principaux
+    sf::Text m_statusText;                  ///< Dernier message d'état (sauvegarde...)
+    InfoValues m_infoValues;                ///< Valeurs des textes actuels
+    bool m_infoValid;                       ///< Les textes ont été composés au moins une fois
+    sf::RenderTexture m_sidePanelCache;     ///< Panneau latéral pré-rendu
+    sf::Sprite m_sidePanelSprite;
+    std::string m_sidePanelPattern;         ///< Contenu du panneau pré-rendu
+    bool m_sidePanelToroidal;
+    bool m_sidePanelParallel;
+    bool m_sidePanelShowGrid;
+    bool m_sidePanelValid;
+    sf::RenderTexture m_helpCache;          ///< Cadre d'aide pré-rendu
+    sf::Sprite m_helpSprite;
+    bool m_helpValid;
+    sf::RectangleShape m_perfBackground;    ///< Fond du panneau de performances
+    sf::Text m_perfText;                    ///< Mesures du panneau de performances
+    sf::VertexArray m_perfGraph;            ///< Barres des dernières durées d'image
+
+    static constexpr float HELP_BOX_WIDTH = 500.f;
+    static constexpr float HELP_BOX_HEIGHT = 540.f;
+    static constexpr float PERF_BOX_WIDTH = 300.f;
+    static constexpr float PERF_BOX_HEIGHT = 220.f;
+    static constexpr float PERF_GRAPH_HEIGHT = 60.f;
+
+    /**
+     * @brief Convertit un rectangle de cellules en pixels RGBA et l'envoie à la texture
+     */
+    void uploadRegion(const SimulationFrame& frame, int x, int y, int width, int height);
+
+    /**
+     * @brief Ramène la caméra dans la grille (pas de défilement au-delà des bords)
+     */
+    void clampCamera(int gridWidth, int gridHeight);
+
+    /**
+     * @brief Met la pyramide à jour (tuiles modifiées seulement si possible)
+     */
+    void updatePyramid(const SimulationFrame& frame);
+
+    /**
+     * @brief Dessine la densité de cellules vivantes, un pixel par bloc du niveau m_lodLevel
+     */
+    void renderDensity(const SimulationFrame& frame);
+
+    /**
+     * @brief Dessine le contenu du panneau latéral sur une cible (fenêtre ou texture)
+     */
+    void drawSidePanel(sf::RenderTarget& target, const std::string& selectedPattern, bool toroidal,
+                       bool parallel, float height);
+
+    /**
+     * @brief Dessine le cadre d'aide sur une cible, coin supérieur gauche en (x, y)
+     */
+    void drawHelpBox(sf::RenderTarget& target, float x, float y);
 
 public:
+    /**
+     * @brief Niveau de densité maximal (un pixel pour 2^16 x 2^16 cellules)
+     */
+    static constexpr int MAX_LOD_LEVEL = 16;
+
     /**
      * @brief Constructeur
      * @param window Fenêtre SFML
@@ -36,13 +137,25 @@ public:
     GUIRenderer(sf::RenderWindow& window, int cellSize = 10);
     
     /**
-     * @brief Dessine la grille complète
-     * @param grid Grille à dessiner
+     * @brief Dessine la partie visible de la grille
+     * 
+     * Seules les cellules comprises dans la vue (à partir de la caméra) sont traitées : elles
+     * sont gardées dans une texture (un texel par cellule) dessinée en un seul appel, agrandie
+     * à la taille des cellules ; les lignes de grille forment un second appel. Si la texture
+     * contient déjà la vue de la publication de référence de la frame, seules les tuiles
+     * modifiées visibles sont renvoyées ; sinon toute la vue l'est.
+     * 
+     * En dessous d'un pixel par cellule (niveau de densité > 0), chaque pixel montre la
+     * proportion de cellules vivantes de son bloc, lue dans une pyramide de densité.
+     * 
+     * @param frame Génération publiée par le thread de simulation
      */
-    void render(const Grid& grid);
+    void render(const SimulationFrame& frame);
     
     /**
      * @brief Dessine le panneau d'information en haut
+     * 
+     * Les textes ne sont recomposés que si l'une des valeurs affichées a changé.
      * @param iteration Numéro d'itération
      * @param running État de la simulation
      * @param speed Vitesse (ms entre itérations)
@@ -52,12 +165,19 @@ public:
      * @param stable L'automate est stable
      * @param gridWidth Largeur de la grille
      * @param gridHeight Hauteur de la grille
+     * @param turbo Mode turbo actif
+     * @param turboRate Débit visé en turbo (générations/s, 0 = maximal)
+     * @param generationsPerSecond Débit mesuré
      */
     void renderInfoPanel(int iteration, bool running, int speed, bool toroidal, bool parallel, 
-                         int aliveCells, bool stable, int gridWidth, int gridHeight);
+                         int aliveCells, bool stable, int gridWidth, int gridHeight,
+                         bool turbo = false, int turboRate = 0, int generationsPerSecond = 0);
     
     /**
      * @brief Dessine le panneau latéral avec les options
+     * 
+     * Le panneau est pré-rendu dans une texture, refaite seulement quand le pattern, une
+     * option ou la hauteur de la fenêtre change.
      * @param selectedPattern Pattern actuellement sélectionné
      * @param toroidal Mode torique
      * @param parallel Mode parallèle
@@ -65,19 +185,21 @@ public:
     void renderSidePanel(const std::string& selectedPattern, bool toroidal, bool parallel);
     
     /**
-     * @brief Dessine les instructions (aide)
+     * @brief Dessine les instructions (aide), cadre pré-rendu une fois dans une texture
      */
     void renderHelp();
     
     /**
-     * @brief Convertit une position écran en position grille
+     * @brief Convertit une position écran en position grille (caméra comprise)
      * @param screenX Position X écran
      * @param screenY Position Y écran
      * @param gridX Position X grille (sortie)
      * @param gridY Position Y grille (sortie)
+     * @param gridWidth Largeur de la grille
+     * @param gridHeight Hauteur de la grille
      * @return true si la position est valide
      */
-    bool screenToGrid(int screenX, int screenY, int& gridX, int& gridY, const Grid& grid) const;
+    bool screenToGrid(int screenX, int screenY, int& gridX, int& gridY, int gridWidth, int gridHeight) const;
     
     /**
      * @brief Vérifie si un clic est dans le panneau latéral
@@ -87,6 +209,66 @@ public:
      */
     int getSidePanelButtonAt(int screenX, int screenY) const;
     
+    /**
+     * @brief Change le zoom en gardant fixe la cellule sous un point de l'écran
+     * @param cellSize Taille des cellules en pixels (ignorée si lodLevel > 0)
+     * @param lodLevel Niveau de densité : un pixel pour 2^lodLevel x 2^lodLevel cellules
+     */
+    void zoomAt(int screenX, int screenY, int cellSize, int lodLevel = 0);
+    
+    /**
+     * @brief Nombre de cellules couvertes par une distance à l'écran
+     */
+    int pixelsToCells(int pixels) const;
+    
+    /**
+     * @brief Déplace la caméra (en cellules)
+     */
+    void pan(int columns, int rows) { m_cameraX += columns; m_cameraY += rows; }
+    void setCamera(int x, int y) { m_cameraX = x; m_cameraY = y; }
+    int getCameraX() const { return m_cameraX; }
+    int getCameraY() const { return m_cameraY; }
+    
+    /**
+     * @brief Nombre de cellules entières visibles dans la vue
+     */
+    int getViewColumns() const;
+    int getViewRows() const;
+    
+    /**
+     * @brief Message d'état affiché dans le panneau d'information (vide = aucun)
+     * @param message Texte du message
+     * @param error Affiché comme une erreur
+     */
+    void setStatus(const std::string& message, bool error);
+    
+    /**
+     * @brief Mesures affichées par le panneau de performances
+     */
+    struct PerfStats {
+        float eventsMs = 0.f;                   ///< Traitement des événements (dernière image)
+        float updateMs = 0.f;                   ///< Récupération de la génération (dernière image)
+        float renderMs = 0.f;                   ///< Dessin, hors attente de l'affichage (dernière image)
+        double stepMs = 0.0;                    ///< Calcul de la dernière génération (Game)
+        double generationsPerSecond = 0.0;      ///< Débit de la simulation
+        double framesPerSecond = 0.0;           ///< Images dessinées par seconde
+        size_t gridBytes = 0;                   ///< Mémoire estimée de la grille
+        const FrameHistory* frameTimes = nullptr; ///< Durées des dernières images (ms)
+    };
+    
+    /**
+     * @brief Dessine le panneau de performances en surimpression, en haut à gauche de la grille
+     * 
+     * Durées de la dernière image par étape, débits, min/moy/max et graphe des dernières
+     * durées d'image (vert sous 16,7 ms, orange sous 33,3 ms, rouge au-delà), mémoire.
+     */
+    void renderPerfOverlay(const PerfStats& stats);
+    
+    /**
+     * @brief Mémoire des tampons d'affichage (pixels et pyramide de densité), en octets
+     */
+    size_t memoryBytes() const { return m_pixels.capacity() + m_pyramid.memoryBytes(); }
+    
     // Setters pour la personnalisation
     void setCellSize(int size) { m_cellSize = size; }
     void setShowGrid(bool show) { m_showGrid = show; }
@@ -95,6 +277,7 @@ public:
     void setDeadColor(sf::Color color) { m_deadColor = color; }
     
     int getCellSize() const { return m_cellSize; }
+    int getLodLevel() const { return m_lodLevel; }
     bool isShowGrid() const { return m_showGrid; }
     int getOffsetY() const { return m_offsetY; }
     int getPanelWidth() const { return m_panelWidth; }
@@ -0,0 +1,71 @@
+#ifndef ASYNCWRITER_HPP
+#define ASYNCWRITER_HPP
+
+#include <functional>
+#include <deque>
+#include <string>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+/**
+ * @brief Exécute des écritures de fichiers sur un thread d'arrière-plan
+ *
+ * Les tâches sont exécutées dans l'ordre de soumission. Une exception levée par une
+ * tâche n'interrompt pas le thread : son message est conservé et peut être récupéré
+ * avec takeError().
+ */
+class AsyncWriter {
+public:
+    using Job = std::function<void()>;
+
+private:
+    std::deque<Job> m_jobs;                 ///< Tâches en attente
+    std::thread m_thread;                   ///< Thread d'écriture
+    mutable std::mutex m_mutex;             ///< Protège la file et l'état
+    std::condition_variable m_wakeUp;       ///< Signale une nouvelle tâche ou l'arrêt
+    std::condition_variable m_idle;         ///< Signale que la file est vide
+    size_t m_pending;                       ///< Tâches soumises non terminées
+    bool m_stopping;                        ///< Arrêt demandé
+    std::string m_error;                    ///< Dernière erreur non consultée
+
+    /**
+     * @brief Boucle du thread d'écriture
+     */
+    void run();
+
+public:
+    AsyncWriter();
+
+    /**
+     * @brief Destructeur : termine les tâches en attente puis arrête le thread
+     */
+    ~AsyncWriter();
+
+    AsyncWriter(const AsyncWriter&) = delete;
+    AsyncWriter& operator=(const AsyncWriter&) = delete;
+
+    /**
+     * @brief Ajoute une tâche à la file (ne bloque pas)
+     * @param job Tâche à exécuter sur le thread d'écriture
+     */
+    void submit(Job job);
+
+    /**
+     * @brief Nombre de tâches soumises et pas encore terminées
+     */
+    size_t pending() const;
+
+    /**
+     * @brief Attend la fin de toutes les tâches soumises
+     */
+    void flush();
+
+    /**
+     * @brief Retourne et efface la dernière erreur survenue
+     * @return Message d'erreur, vide si aucune erreur
+     */
+    std::string takeError();
+};
+
+#endif // ASYNCWRITER_HPP
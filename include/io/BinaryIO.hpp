@@ -0,0 +1,72 @@
+#ifndef BINARYIO_HPP
+#define BINARYIO_HPP
+
+#include <vector>
+#include <cstdint>
+#include <stdexcept>
+
+/**
+ * @brief Fonctions d'encodage binaire communes aux formats de fichiers
+ *
+ * Les entiers sont stockés en petit-boutiste, indépendamment de la plateforme.
+ */
+namespace BinaryIO {
+
+    inline void putU32(std::vector<std::uint8_t>& out, std::uint32_t value) {
+        for (int i = 0; i < 4; ++i) out.push_back(static_cast<std::uint8_t>(value >> (8 * i)));
+    }
+
+    inline void putU64(std::vector<std::uint8_t>& out, std::uint64_t value) {
+        for (int i = 0; i < 8; ++i) out.push_back(static_cast<std::uint8_t>(value >> (8 * i)));
+    }
+
+    inline void putVarint(std::vector<std::uint8_t>& out, std::uint64_t value) {
+        while (value >= 0x80) {
+            out.push_back(static_cast<std::uint8_t>(value | 0x80));
+            value >>= 7;
+        }
+        out.push_back(static_cast<std::uint8_t>(value));
+    }
+
+    inline std::uint32_t getU32(const std::uint8_t* data) {
+        std::uint32_t value = 0;
+        for (int i = 0; i < 4; ++i) value |= static_cast<std::uint32_t>(data[i]) << (8 * i);
+        return value;
+    }
+
+    inline std::uint64_t getU64(const std::uint8_t* data) {
+        std::uint64_t value = 0;
+        for (int i = 0; i < 8; ++i) value |= static_cast<std::uint64_t>(data[i]) << (8 * i);
+        return value;
+    }
+
+    /**
+     * @brief Lit un entier de longueur variable et avance la position
+     * @throw std::runtime_error si les données sont tronquées
+     */
+    inline std::uint64_t getVarint(const std::vector<std::uint8_t>& data, size_t& pos) {
+        std::uint64_t value = 0;
+        int shift = 0;
+        while (pos < data.size() && shift < 64) {
+            std::uint8_t byte = data[pos++];
+            value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+            if ((byte & 0x80) == 0) return value;
+            shift += 7;
+        }
+        throw std::runtime_error("Corrupted data: truncated varint");
+    }
+
+    /**
+     * @brief Empreinte FNV-1a 64 bits d'un bloc de données
+     */
+    inline std::uint64_t fnv1a(const std::uint8_t* data, size_t size, std::uint64_t hash = 14695981039346656037ULL) {
+        for (size_t i = 0; i < size; ++i) {
+            hash ^= data[i];
+            hash *= 1099511628211ULL;
+        }
+        return hash;
+    }
+
+} // namespace BinaryIO
+
+#endif // BINARYIO_HPP
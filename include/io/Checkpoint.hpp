@@ -0,0 +1,87 @@
+#ifndef CHECKPOINT_HPP
+#define CHECKPOINT_HPP
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include "../game/Game.hpp"
+
+/**
+ * @brief Instantané complet d'une simulation, suffisant pour la reprendre à l'identique
+ */
+struct CheckpointData {
+    int width = 0;                              ///< Largeur de la grille
+    int height = 0;                             ///< Hauteur de la grille
+    bool toroidal = false;                      ///< Mode torique
+    std::string ruleName;                       ///< Nom de la règle (vérifié à la reprise)
+    int iteration = 0;                          ///< Numéro d'itération
+    std::vector<std::uint8_t> cells;            ///< Codes de la grille courante
+    std::vector<std::uint8_t> previousCells;    ///< Codes de la grille précédente (détection de stabilité)
+};
+
+/**
+ * @brief Gestion des points de contrôle des longues simulations console
+ *
+ * La capture est une simple copie des codes de cellules : la sérialisation et l'écriture
+ * peuvent ensuite se faire sur un autre thread. L'écriture est atomique (fichier temporaire
+ * puis renommage) et protégée par une somme de contrôle, si bien qu'un arrêt brutal laisse
+ * toujours au moins un point de contrôle valide.
+ */
+class Checkpoint {
+public:
+    /**
+     * @brief Capture l'état d'une simulation
+     * @param game Simulation en cours
+     * @return Instantané indépendant du jeu
+     */
+    static CheckpointData capture(const Game& game);
+
+    /**
+     * @brief Restaure l'état d'une simulation
+     * @param data Instantané à restaurer
+     * @param game Simulation à mettre à jour (sa règle doit correspondre)
+     * @throw std::runtime_error si la règle ne correspond pas
+     */
+    static void restore(const CheckpointData& data, Game& game);
+
+    /**
+     * @brief Écrit un point de contrôle de façon atomique
+     * @param data Instantané à écrire
+     * @param filepath Chemin du fichier final
+     * @throw std::runtime_error si l'écriture échoue
+     */
+    static void write(const CheckpointData& data, const std::string& filepath);
+
+    /**
+     * @brief Lit un point de contrôle
+     * @param filepath Chemin du fichier
+     * @return Instantané lu
+     * @throw std::runtime_error si le fichier est invalide ou corrompu
+     */
+    static CheckpointData read(const std::string& filepath);
+
+    /**
+     * @brief Génère le nom de fichier d'un point de contrôle
+     * @param directory Dossier des points de contrôle
+     * @param iteration Numéro d'itération
+     * @return Chemin complet du fichier
+     */
+    static std::string getCheckpointFilename(const std::string& directory, int iteration);
+
+    /**
+     * @brief Charge le point de contrôle valide le plus récent d'un dossier
+     * @param directory Dossier des points de contrôle
+     * @param data Instantané lu (sortie)
+     * @return Chemin du fichier chargé, vide si aucun point de contrôle valide
+     */
+    static std::string loadLatest(const std::string& directory, CheckpointData& data);
+
+    /**
+     * @brief Supprime les anciens points de contrôle
+     * @param directory Dossier des points de contrôle
+     * @param keep Nombre de points de contrôle les plus récents à conserver
+     */
+    static void prune(const std::string& directory, int keep);
+};
+
+#endif // CHECKPOINT_HPP
@@ -3,8 +3,12 @@
 
 #include <string>
 #include <memory>
+#include <vector>
+#include <cstdint>
 #include <filesystem>
 #include "../grid/Grid.hpp"
+#include "../grid/BandedGrid.hpp"
+#include "../grid/QuadTree.hpp"
 
 /**
  * @brief Classe gérant la lecture/écriture des fichiers
@@ -16,6 +20,9 @@ class FileHandler {
 public:
     /**
      * @brief Charge une grille depuis un fichier
+     * 
+     * Les fichiers d'extension .mc sont lus au format macrocell.
+     * 
      * @param filepath Chemin du fichier
      * @param toroidal Mode torique
      * @return Grille chargée
@@ -24,12 +31,72 @@ public:
     static std::unique_ptr<Grid> loadFromFile(const std::string& filepath, bool toroidal = false);
     
     /**
-     * @brief Sauvegarde une grille dans un fichier
+     * @brief Sauvegarde une grille dans un fichier (format macrocell si l'extension est .mc)
      * @param grid Grille à sauvegarder
      * @param filepath Chemin du fichier
      */
     static void saveToFile(const Grid& grid, const std::string& filepath);
     
+    /**
+     * @brief Sauvegarde une grille donnée par ses codes (format macrocell si l'extension est .mc)
+     * 
+     * Permet d'écrire une copie des codes sans reconstruire de Grid (sauvegarde en arrière-plan).
+     * 
+     * @param width Largeur de la grille
+     * @param height Hauteur de la grille
+     * @param codes Codes ligne par ligne (0 mort, 1 vivant, 2 obstacle mort, 3 obstacle vivant)
+     * @param filepath Chemin du fichier
+     * @throw std::runtime_error si le fichier ne peut pas être créé
+     */
+    static void saveCodes(int width, int height, const std::vector<std::uint8_t>& codes, const std::string& filepath);
+    
+    /**
+     * @brief Charge un fichier directement dans une grille stockée par bandes
+     * 
+     * Le fichier est lu ligne par ligne sans jamais construire de Grid en mémoire.
+     * 
+     * @param filepath Chemin du fichier
+     * @param storagePath Préfixe des fichiers de stockage des bandes
+     * @param toroidal Mode torique
+     * @param bandRows Nombre de lignes par bande
+     * @return Grille chargée
+     * @throw std::runtime_error si le fichier est invalide
+     */
+    static std::unique_ptr<BandedGrid> loadBandedGrid(const std::string& filepath, const std::string& storagePath,
+                                                      bool toroidal = false, int bandRows = 256);
+    
+    /**
+     * @brief Sauvegarde une grille stockée par bandes (mêmes formats que pour Grid)
+     * @param grid Grille à sauvegarder
+     * @param filepath Chemin du fichier
+     */
+    static void saveToFile(const BandedGrid& grid, const std::string& filepath);
+    
+    /**
+     * @brief Charge un fichier macrocell (.mc) sous forme d'arbre quaternaire
+     * 
+     * Les sous-arbres identiques sont partagés : un motif immense mais régulier est chargé
+     * sans construire de grille dense. Les formats à deux états (feuilles 8x8) et
+     * multi-états (nœuds de niveau 1, codes 0 à 3) sont acceptés. Sans dimensions de
+     * grille dans le fichier, la grille est réduite au rectangle englobant le motif.
+     * 
+     * @param filepath Chemin du fichier
+     * @return Arbre chargé
+     * @throw std::runtime_error si le fichier est invalide
+     */
+    static std::unique_ptr<QuadTree> loadMacrocell(const std::string& filepath);
+    
+    /**
+     * @brief Sauvegarde un arbre quaternaire au format macrocell (.mc)
+     * 
+     * Chaque nœud partagé n'est écrit qu'une fois. Le format multi-états n'est utilisé
+     * que si la grille contient des obstacles.
+     * 
+     * @param tree Arbre à sauvegarder
+     * @param filepath Chemin du fichier
+     */
+    static void saveMacrocell(const QuadTree& tree, const std::string& filepath);
+    
     /**
      * @brief Crée le dossier de sortie pour les itérations
      * @param inputFilepath Chemin du fichier d'entrée
@@ -41,9 +108,11 @@ public:
      * @brief Génère le nom de fichier pour une itération
      * @param outputDir Dossier de sortie
      * @param iteration Numéro d'itération
+     * @param extension Extension du fichier (".txt" ou ".mc")
      * @return Chemin complet du fichier
      */
-    static std::string getIterationFilename(const std::string& outputDir, int iteration);
+    static std::string getIterationFilename(const std::string& outputDir, int iteration,
+                                            const std::string& extension = ".txt");
     
     /**
      * @brief Extrait le nom de base d'un fichier (sans extension)
@@ -51,6 +120,13 @@ public:
      * @return Nom de base
      */
     static std::string getBaseName(const std::string& filepath);
+    
+    /**
+     * @brief Extrait l'extension d'un fichier en minuscules (avec le point)
+     * @param filepath Chemin du fichier
+     * @return Extension (ex: ".txt"), vide si absente
+     */
+    static std::string getExtension(const std::string& filepath);
 };
 
 #endif // FILEHANDLER_HPP
@@ -0,0 +1,133 @@
+#ifndef GENERATIONARCHIVE_HPP
+#define GENERATIONARCHIVE_HPP
+
+#include <string>
+#include <memory>
+#include <vector>
+#include <fstream>
+#include <cstdint>
+#include "../grid/Grid.hpp"
+
+/**
+ * @brief Entrée de l'index d'une archive de générations
+ */
+struct ArchiveIndexEntry {
+    int generation;        ///< Numéro de génération
+    bool keyframe;         ///< true si image complète, false si delta
+    std::uint64_t offset;  ///< Position de l'enregistrement dans le fichier
+};
+
+/**
+ * @brief Écrit une simulation complète dans un seul fichier archive (.gola)
+ *
+ * Structure du fichier :
+ * - en-tête (dimensions, mode torique, intervalle entre images clés)
+ * - une image clé complète toutes les N générations (codes compressés par RLE)
+ * - entre deux images clés, des deltas ne contenant que les cellules modifiées
+ * - un index à la fin pour accéder directement à n'importe quelle génération
+ */
+class ArchiveWriter {
+private:
+    std::ofstream m_file;                       ///< Fichier de sortie
+    std::string m_filepath;                     ///< Chemin du fichier
+    int m_width;                                ///< Largeur de la grille
+    int m_height;                               ///< Hauteur de la grille
+    int m_keyframeInterval;                     ///< Nombre de générations entre deux images clés
+    std::vector<std::uint8_t> m_previous;       ///< Codes de la génération précédente
+    std::vector<ArchiveIndexEntry> m_index;     ///< Index des enregistrements écrits
+    bool m_closed;                              ///< L'index a été écrit
+
+public:
+    /**
+     * @brief Constructeur : crée le fichier et écrit l'en-tête
+     * @param filepath Chemin du fichier archive
+     * @param width Largeur de la grille
+     * @param height Hauteur de la grille
+     * @param toroidal Mode torique de la simulation
+     * @param keyframeInterval Nombre de générations entre deux images clés
+     * @throw std::runtime_error si le fichier ne peut pas être créé
+     */
+    ArchiveWriter(const std::string& filepath, int width, int height, bool toroidal,
+                  int keyframeInterval = 64);
+
+    /**
+     * @brief Destructeur : écrit l'index si close() n'a pas été appelé
+     */
+    ~ArchiveWriter();
+
+    ArchiveWriter(const ArchiveWriter&) = delete;
+    ArchiveWriter& operator=(const ArchiveWriter&) = delete;
+
+    /**
+     * @brief Ajoute la génération suivante à l'archive
+     * @param grid Grille de la génération (mêmes dimensions que l'archive)
+     * @throw std::runtime_error si l'écriture échoue ou si les dimensions diffèrent
+     */
+    void append(const Grid& grid);
+
+    /**
+     * @brief Écrit l'index final et ferme le fichier
+     */
+    void close();
+
+    /**
+     * @brief Retourne le nombre de générations écrites
+     */
+    int getGenerationCount() const { return static_cast<int>(m_index.size()); }
+};
+
+/**
+ * @brief Lit une archive de générations avec accès direct
+ *
+ * La reconstruction d'une génération k décode au plus une image clé
+ * puis rejoue au plus (intervalle - 1) deltas.
+ * Si l'index final est absent (simulation interrompue), il est reconstruit
+ * en parcourant les enregistrements.
+ */
+class ArchiveReader {
+private:
+    mutable std::ifstream m_file;               ///< Fichier d'entrée
+    int m_width;                                ///< Largeur de la grille
+    int m_height;                               ///< Hauteur de la grille
+    bool m_toroidal;                            ///< Mode torique
+    int m_keyframeInterval;                     ///< Intervalle entre images clés
+    std::vector<ArchiveIndexEntry> m_index;     ///< Index des enregistrements
+
+    /**
+     * @brief Reconstruit l'index en parcourant le fichier
+     * @param dataStart Position du premier enregistrement
+     */
+    void scanRecords(std::uint64_t dataStart);
+
+public:
+    /**
+     * @brief Ouvre une archive
+     * @param filepath Chemin du fichier archive
+     * @throw std::runtime_error si le fichier est invalide
+     */
+    explicit ArchiveReader(const std::string& filepath);
+
+    // Getters
+    int getWidth() const { return m_width; }
+    int getHeight() const { return m_height; }
+    bool isToroidal() const { return m_toroidal; }
+    int getKeyframeInterval() const { return m_keyframeInterval; }
+    int getGenerationCount() const { return static_cast<int>(m_index.size()); }
+
+    /**
+     * @brief Reconstruit les codes des cellules d'une génération
+     * @param generation Numéro de génération (0 = état initial)
+     * @return Codes ligne par ligne
+     * @throw std::out_of_range si la génération n'existe pas
+     */
+    std::vector<std::uint8_t> readCodes(int generation) const;
+
+    /**
+     * @brief Reconstruit la grille d'une génération
+     * @param generation Numéro de génération (0 = état initial)
+     * @return Grille reconstruite
+     */
+    std::unique_ptr<Grid> readGeneration(int generation) const;
+};
+
+#endif // GENERATIONARCHIVE_HPP
@@ -0,0 +1,40 @@
+#ifndef MAPPEDFILE_HPP
+#define MAPPEDFILE_HPP
+
+#include <string>
+#include <cstddef>
+
+/**
+ * @brief Projection en mémoire d'un fichier en lecture seule
+ *
+ * Utilise mmap (POSIX) ou CreateFileMapping (Windows) pour accéder au contenu
+ * d'un fichier sans le copier. Le fichier reste projeté pendant la durée de vie de l'objet.
+ */
+class MappedFile {
+private:
+    const char* m_data;     ///< Début du contenu projeté (nullptr si fichier vide)
+    std::size_t m_size;     ///< Taille du fichier en octets
+#ifdef _WIN32
+    void* m_fileHandle;     ///< Handle du fichier
+    void* m_mappingHandle;  ///< Handle de la projection
+#endif
+
+public:
+    /**
+     * @brief Projette un fichier en mémoire
+     * @param filepath Chemin du fichier
+     * @throw std::runtime_error si le fichier ne peut pas être ouvert ou projeté
+     */
+    explicit MappedFile(const std::string& filepath);
+
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    // Getters
+    const char* data() const { return m_data; }
+    std::size_t size() const { return m_size; }
+};
+
+#endif // MAPPEDFILE_HPP
@@ -0,0 +1,83 @@
+#ifndef COUNTERRNG_HPP
+#define COUNTERRNG_HPP
+
+#include <cstdint>
+
+/**
+ * @brief Générateur pseudo-aléatoire à compteur (Philox 4x32-10)
+ *
+ * Chaque bloc de quatre nombres est une fonction pure de (graine, flux, compteur) :
+ * le flux i donne toujours la même suite, quel que soit le thread qui la calcule ou
+ * l'ordre dans lequel les flux sont traités. Aucun état partagé entre threads.
+ */
+class CounterRng {
+private:
+    std::uint32_t m_key[2];         ///< Clé dérivée de la graine
+    std::uint64_t m_stream;         ///< Numéro du flux
+    std::uint64_t m_counter;        ///< Numéro du prochain bloc
+    std::uint32_t m_block[4];       ///< Bloc courant
+    int m_used;                     ///< Nombres déjà consommés dans le bloc courant
+
+    static void mulhilo(std::uint32_t a, std::uint32_t b, std::uint32_t& hi, std::uint32_t& lo) {
+        std::uint64_t product = static_cast<std::uint64_t>(a) * b;
+        hi = static_cast<std::uint32_t>(product >> 32);
+        lo = static_cast<std::uint32_t>(product);
+    }
+
+    void generateBlock() {
+        std::uint32_t x[4] = {
+            static_cast<std::uint32_t>(m_counter), static_cast<std::uint32_t>(m_counter >> 32),
+            static_cast<std::uint32_t>(m_stream), static_cast<std::uint32_t>(m_stream >> 32)
+        };
+        std::uint32_t k0 = m_key[0];
+        std::uint32_t k1 = m_key[1];
+
+        for (int round = 0; round < 10; ++round) {
+            std::uint32_t hi0, lo0, hi1, lo1;
+            mulhilo(0xD2511F53u, x[0], hi0, lo0);
+            mulhilo(0xCD9E8D57u, x[2], hi1, lo1);
+            x[0] = hi1 ^ x[1] ^ k0;
+            x[1] = lo1;
+            x[2] = hi0 ^ x[3] ^ k1;
+            x[3] = lo0;
+            k0 += 0x9E3779B9u;
+            k1 += 0xBB67AE85u;
+        }
+
+        for (int i = 0; i < 4; ++i) m_block[i] = x[i];
+        ++m_counter;
+        m_used = 0;
+    }
+
+public:
+    /**
+     * @brief Constructeur
+     * @param seed Graine commune à tous les flux
+     * @param stream Numéro du flux (ex: numéro de la soupe)
+     */
+    CounterRng(std::uint64_t seed, std::uint64_t stream)
+        : m_key{static_cast<std::uint32_t>(seed), static_cast<std::uint32_t>(seed >> 32)}
+        , m_stream(stream)
+        , m_counter(0)
+        , m_block{0, 0, 0, 0}
+        , m_used(4)
+    {
+    }
+
+    /**
+     * @brief Entier uniforme sur 32 bits
+     */
+    std::uint32_t next() {
+        if (m_used == 4) generateBlock();
+        return m_block[m_used++];
+    }
+
+    /**
+     * @brief Réel uniforme dans [0, 1)
+     */
+    double nextDouble() {
+        return next() * (1.0 / 4294967296.0);
+    }
+};
+
+#endif // COUNTERRNG_HPP
@@ -0,0 +1,55 @@
+#ifndef FRAMEHISTORY_HPP
+#define FRAMEHISTORY_HPP
+
+#include <cstddef>
+#include <vector>
+
+/**
+ * @brief Fenêtre glissante des dernières mesures (durées d'image en ms...)
+ *
+ * Tampon circulaire de taille fixe : l'ajout ne fait jamais d'allocation, la plus
+ * ancienne mesure est remplacée une fois la fenêtre pleine.
+ */
+class FrameHistory {
+public:
+    static constexpr size_t DEFAULT_CAPACITY = 120;    ///< Deux secondes à 60 images/s
+
+private:
+    std::vector<float> m_samples;   ///< Mesures (tampon circulaire)
+    size_t m_next;                  ///< Emplacement de la prochaine mesure
+    size_t m_count;                 ///< Mesures présentes
+
+public:
+    /**
+     * @brief Constructeur
+     * @param capacity Nombre de mesures conservées (au moins 1)
+     */
+    explicit FrameHistory(size_t capacity = DEFAULT_CAPACITY);
+
+    /**
+     * @brief Ajoute une mesure (remplace la plus ancienne si la fenêtre est pleine)
+     */
+    void push(float value);
+
+    /**
+     * @brief Vide la fenêtre
+     */
+    void clear();
+
+    size_t getCount() const { return m_count; }
+    size_t getCapacity() const { return m_samples.size(); }
+
+    /**
+     * @brief Mesure index de la fenêtre (0 = la plus ancienne)
+     */
+    float getSample(size_t index) const;
+
+    /**
+     * @brief Minimum, moyenne et maximum de la fenêtre (0 si vide)
+     */
+    float getMin() const;
+    float getAverage() const;
+    float getMax() const;
+};
+
+#endif // FRAMEHISTORY_HPP
@@ -0,0 +1,145 @@
+#ifndef METRICS_HPP
+#define METRICS_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+
+/**
+ * @brief Histogramme de durées à seaux logarithmiques (puissances de 2 en nanosecondes)
+ *
+ * Les enregistrements sont atomiques et sans verrou : plusieurs threads de calcul
+ * peuvent enregistrer dans le même histogramme.
+ */
+class Histogram {
+public:
+    static constexpr int BUCKET_COUNT = 64;     ///< Seau i : durées dans [2^(i-1), 2^i[ ns (seau 0 : 0 ns)
+
+private:
+    std::atomic<std::uint64_t> m_count{0};
+    std::atomic<std::uint64_t> m_sum{0};
+    std::atomic<std::uint64_t> m_min{UINT64_MAX};
+    std::atomic<std::uint64_t> m_max{0};
+    std::atomic<std::uint64_t> m_buckets[BUCKET_COUNT] = {};
+
+public:
+    /**
+     * @brief Enregistre une durée
+     * @param nanoseconds Durée en nanosecondes
+     */
+    void record(std::uint64_t nanoseconds);
+
+    /**
+     * @brief Remet l'histogramme à zéro
+     */
+    void reset();
+
+    std::uint64_t getCount() const { return m_count.load(std::memory_order_relaxed); }
+    std::uint64_t getSum() const { return m_sum.load(std::memory_order_relaxed); }
+    std::uint64_t getMin() const;
+    std::uint64_t getMax() const { return m_max.load(std::memory_order_relaxed); }
+    std::uint64_t getBucket(int index) const { return m_buckets[index].load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Quantile approché (interpolé dans le seau, borné par le minimum et le maximum observés)
+     * @param quantile Quantile dans [0, 1]
+     * @return Durée en nanosecondes (0 si vide)
+     */
+    std::uint64_t percentile(double quantile) const;
+};
+
+/**
+ * @brief Temps passé par phase de simulation, agrégé en histogrammes
+ *
+ * Désactivé par défaut : une phase non mesurée ne coûte qu'un test de booléen.
+ * Une fois activé, chaque phase enregistre sa durée (horloge monotone) à chaque passage.
+ */
+class Metrics {
+public:
+    /**
+     * @brief Phases mesurées
+     */
+    enum class Phase {
+        NeighborCount,      ///< Comptage des voisins (Grid::update)
+        RuleApply,          ///< Application de la règle (Grid::update)
+        StateApply,         ///< Application des nouveaux états (Grid::update)
+        Snapshot,           ///< Copie de la grille précédente (Game::step)
+        StabilityCheck,     ///< Détection de stabilité et de cycle (Game::step)
+        Step,               ///< Itération complète (Game::step)
+        FileLoad,           ///< Lecture de la grille initiale (mode console)
+        FileSave,           ///< Écriture d'une itération (mode console)
+        Count
+    };
+
+private:
+    static std::atomic<bool> s_enabled;
+    Histogram m_histograms[static_cast<int>(Phase::Count)];
+
+    Metrics() = default;
+
+public:
+    /**
+     * @brief Instance globale
+     */
+    static Metrics& instance();
+
+    static bool isEnabled() { return s_enabled.load(std::memory_order_relaxed); }
+    static void setEnabled(bool enabled) { s_enabled.store(enabled, std::memory_order_relaxed); }
+
+    /**
+     * @brief Nom d'une phase dans le JSON (ex: "grid.neighbors")
+     */
+    static const char* getPhaseName(Phase phase);
+
+    /**
+     * @brief Enregistre une durée pour une phase
+     */
+    void record(Phase phase, std::uint64_t nanoseconds) {
+        m_histograms[static_cast<int>(phase)].record(nanoseconds);
+    }
+
+    const Histogram& getHistogram(Phase phase) const { return m_histograms[static_cast<int>(phase)]; }
+
+    /**
+     * @brief Remet toutes les phases à zéro
+     */
+    void reset();
+
+    /**
+     * @brief Écrit les histogrammes au format JSON (phases jamais mesurées omises)
+     * @param out Flux de sortie
+     */
+    void writeJson(std::ostream& out) const;
+};
+
+/**
+ * @brief Mesure la durée d'une portée et l'enregistre pour une phase (si les métriques sont actives)
+ */
+class ScopedTimer {
+private:
+    Metrics::Phase m_phase;
+    bool m_active;
+    std::chrono::steady_clock::time_point m_start;
+
+public:
+    explicit ScopedTimer(Metrics::Phase phase)
+        : m_phase(phase)
+        , m_active(Metrics::isEnabled())
+    {
+        if (m_active) m_start = std::chrono::steady_clock::now();
+    }
+
+    ~ScopedTimer() {
+        if (m_active) {
+            auto elapsed = std::chrono::steady_clock::now() - m_start;
+            Metrics::instance().record(m_phase, static_cast<std::uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+        }
+    }
+
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+};
+
+#endif // METRICS_HPP
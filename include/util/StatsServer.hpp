@@ -0,0 +1,134 @@
+#ifndef STATSSERVER_HPP
+#define STATSSERVER_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <thread>
+
+/**
+ * @brief Point d'accès HTTP local exposant l'état d'une simulation au format texte Prometheus
+ *
+ * La boucle de simulation publie son état (publishGeneration...) dans des variables
+ * atomiques ; un thread d'arrière-plan répond aux requêtes GET /metrics sur 127.0.0.1 et
+ * échantillonne la génération chaque seconde pour calculer les débits. Une simulation
+ * bloquée voit donc son débit tomber à zéro et l'âge de sa dernière génération croître,
+ * même si elle ne publie plus rien. Disponible sur les systèmes POSIX uniquement.
+ *
+ * La population et les tuiles actives demandent un parcours de la grille : la simulation
+ * ne les recalcule qu'après une lecture (takePopulationRequest), elles datent donc de la
+ * génération indiquée par gameoflife_population_generation.
+ */
+class StatsServer {
+private:
+    std::atomic<long long> m_generation;        ///< Génération courante
+    std::atomic<long long> m_population;        ///< Cellules vivantes
+    std::atomic<long long> m_activeTiles;       ///< Tuiles contenant au moins une cellule vivante
+    std::atomic<long long> m_cellCount;         ///< Cellules mises à jour par génération
+    std::atomic<long long> m_populationGeneration; ///< Génération de m_population et m_activeTiles
+    std::atomic<long long> m_checkpointQueueDepth; ///< Points de contrôle en attente d'écriture
+    std::atomic<double> m_outputWriteSeconds;   ///< Durée de la dernière écriture d'une génération
+    std::atomic<bool> m_populationRequested;    ///< Lecture reçue depuis le dernier calcul de population
+    std::atomic<std::int64_t> m_lastPublish;    ///< Instant de la dernière publication (ns, horloge monotone)
+    std::atomic<double> m_generationRate;       ///< Générations par seconde (dernier échantillon)
+
+    std::thread m_thread;                       ///< Thread du serveur
+    std::atomic<bool> m_stopping;               ///< Arrêt demandé
+    int m_socket;                               ///< Socket d'écoute (-1 si arrêté)
+    int m_port;                                 ///< Port effectivement ouvert
+
+    /**
+     * @brief Boucle du serveur : accepte les connexions et échantillonne le débit
+     */
+    void run();
+
+    /**
+     * @brief Lit une requête et envoie la réponse
+     */
+    void serve(int client);
+
+    static std::int64_t monotonicNanoseconds();
+
+public:
+    /**
+     * @brief Taille (en cellules) du côté des tuiles comptées par activeTiles
+     */
+    static constexpr int TILE_SIZE = 64;
+
+    StatsServer();
+
+    /**
+     * @brief Destructeur : arrête le serveur
+     */
+    ~StatsServer();
+
+    StatsServer(const StatsServer&) = delete;
+    StatsServer& operator=(const StatsServer&) = delete;
+
+    /**
+     * @brief Ouvre le port sur 127.0.0.1 et démarre le thread du serveur
+     * @param port Port d'écoute (0 = port libre choisi par le système, voir getPort)
+     * @throws std::runtime_error si le port ne peut pas être ouvert
+     */
+    void start(int port);
+
+    /**
+     * @brief Arrête le serveur (sans effet s'il n'est pas démarré)
+     */
+    void stop();
+
+    bool isRunning() const { return m_socket >= 0; }
+    int getPort() const { return m_port; }
+
+    /**
+     * @brief Publie la génération courante (à chaque génération, quelques écritures atomiques)
+     * @param generation Génération courante
+     * @param cellCount Nombre de cellules de la grille (mises à jour à chaque génération)
+     */
+    void publishGeneration(long long generation, long long cellCount);
+
+    /**
+     * @brief Publie la population calculée pour une génération
+     * @param generation Génération du calcul
+     * @param population Nombre de cellules vivantes
+     * @param activeTiles Nombre de tuiles TILE_SIZE x TILE_SIZE contenant une cellule vivante
+     */
+    void publishPopulation(long long generation, long long population, long long activeTiles);
+
+    /**
+     * @brief Publie la génération et sa population
+     */
+    void publish(long long generation, long long population, long long activeTiles, long long cellCount) {
+        publishGeneration(generation, cellCount);
+        publishPopulation(generation, population, activeTiles);
+    }
+
+    /**
+     * @brief Vrai (une seule fois) si /metrics a été lu depuis le dernier appel : la
+     *        population est alors à recalculer
+     */
+    bool takePopulationRequest() { return m_populationRequested.exchange(false, std::memory_order_relaxed); }
+
+    /**
+     * @brief Publie le nombre de points de contrôle en attente d'écriture
+     */
+    void setCheckpointQueueDepth(long long depth) { m_checkpointQueueDepth.store(depth, std::memory_order_relaxed); }
+
+    /**
+     * @brief Publie la durée de la dernière écriture d'une génération (synchrone, bloque la simulation)
+     */
+    void setOutputWriteSeconds(double seconds) { m_outputWriteSeconds.store(seconds, std::memory_order_relaxed); }
+
+    /**
+     * @brief Contenu de la réponse à GET /metrics (format texte Prometheus 0.0.4)
+     */
+    std::string render() const;
+
+    /**
+     * @brief Mémoire résidente du processus en octets (0 si inconnue)
+     */
+    static long long residentMemoryBytes();
+};
+
+#endif // STATSSERVER_HPP
@@ -0,0 +1,75 @@
+#ifndef THREADPOOL_HPP
+#define THREADPOOL_HPP
+
+#include <functional>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <exception>
+
+/**
+ * @brief Groupe de threads persistants exécutant des boucles parallèles
+ *
+ * Les indices sont distribués dynamiquement (compteur atomique) : un thread qui termine
+ * une tâche courte prend immédiatement la suivante, ce qui équilibre la charge même
+ * quand la durée des tâches varie beaucoup. Chaque thread reçoit son numéro, ce qui
+ * permet de réutiliser des tampons par thread.
+ */
+class ThreadPool {
+public:
+    /**
+     * @brief Tâche exécutée pour un indice, avec le numéro du thread (0 à getThreadCount() - 1)
+     */
+    using Task = std::function<void(size_t index, unsigned int worker)>;
+
+private:
+    std::vector<std::thread> m_workers;     ///< Threads du groupe
+    std::mutex m_callMutex;                 ///< Sérialise les appels à parallelFor
+    std::mutex m_mutex;                     ///< Protège l'état partagé
+    std::condition_variable m_wakeUp;       ///< Signale une nouvelle boucle ou l'arrêt
+    std::condition_variable m_done;         ///< Signale la fin de la boucle en cours
+    const Task* m_task;                     ///< Tâche de la boucle en cours
+    size_t m_count;                         ///< Nombre d'indices de la boucle en cours
+    std::atomic<size_t> m_next;             ///< Prochain indice à distribuer
+    unsigned int m_active;                  ///< Threads encore occupés par la boucle en cours
+    unsigned long m_generation;             ///< Numéro de la boucle en cours
+    bool m_stopping;                        ///< Arrêt demandé
+    std::exception_ptr m_error;             ///< Première exception levée par une tâche
+
+    /**
+     * @brief Boucle d'un thread du groupe
+     */
+    void workerLoop(unsigned int worker);
+
+public:
+    /**
+     * @brief Constructeur
+     * @param threadCount Nombre de threads (0 = nombre de cœurs)
+     */
+    explicit ThreadPool(unsigned int threadCount = 0);
+
+    /**
+     * @brief Destructeur : arrête les threads
+     */
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    unsigned int getThreadCount() const { return static_cast<unsigned int>(m_workers.size()); }
+
+    /**
+     * @brief Exécute task(i, worker) pour i de 0 à count - 1 et attend la fin
+     *
+     * Si une tâche lève une exception, les indices restants ne sont pas distribués et
+     * la première exception est relancée dans le thread appelant.
+     *
+     * @param count Nombre d'indices
+     * @param task Tâche à exécuter
+     */
+    void parallelFor(size_t count, const Task& task);
+};
+
+#endif // THREADPOOL_HPP
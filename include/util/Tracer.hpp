@@ -0,0 +1,151 @@
+#ifndef TRACER_HPP
+#define TRACER_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Enregistreur de traces au format Chrome Trace Event (chrome://tracing, Perfetto)
+ *
+ * Désactivé par défaut : une portée non tracée ne coûte qu'un test de booléen. Une fois
+ * démarré, chaque portée TraceSpan devient un événement complet ("ph": "X") sur la piste
+ * de son thread. Les threads portant le même nom (setThreadName) partagent une piste :
+ * les threads de Grid::update, recréés à chaque génération, restent sur « worker i ».
+ */
+class Tracer {
+public:
+    /**
+     * @brief Événement enregistré
+     */
+    struct Event {
+        const char* name;                   ///< Nom de la portée (chaîne statique)
+        const char* category;               ///< Catégorie (simulation, io, gui)
+        std::uint64_t start;                ///< Début en ns depuis le démarrage de la trace
+        std::uint64_t duration;             ///< Durée en ns
+        int track;                          ///< Piste (thread)
+        int argCount;                       ///< Nombre d'arguments
+        const char* argNames[2];            ///< Noms des arguments (chaînes statiques)
+        long long argValues[2];             ///< Valeurs des arguments
+    };
+
+private:
+    static std::atomic<bool> s_enabled;
+
+    mutable std::mutex m_mutex;
+    std::vector<Event> m_events;
+    std::vector<std::string> m_trackNames;
+    size_t m_maxEvents;
+    size_t m_dropped;
+    std::chrono::steady_clock::time_point m_origin;
+
+    Tracer();
+
+public:
+    /**
+     * @brief Instance globale
+     */
+    static Tracer& instance();
+
+    static bool isEnabled() { return s_enabled.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Démarre l'enregistrement (efface la trace précédente)
+     * @param maxEvents Nombre maximal d'événements conservés (les suivants sont comptés puis ignorés)
+     */
+    void start(size_t maxEvents = 1000000);
+
+    /**
+     * @brief Arrête l'enregistrement (la trace reste disponible pour writeJson)
+     */
+    void stop();
+
+    /**
+     * @brief Nomme la piste du thread courant (ex: "main", "worker 2")
+     */
+    static void setThreadName(const std::string& name);
+
+    /**
+     * @brief Piste du thread courant (créée au premier appel)
+     */
+    int currentTrack();
+
+    /**
+     * @brief Instant courant en ns depuis le démarrage de la trace
+     */
+    std::uint64_t now() const {
+        return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - m_origin).count());
+    }
+
+    /**
+     * @brief Enregistre un événement terminé
+     */
+    void record(const Event& event);
+
+    size_t getEventCount() const;
+    size_t getDroppedCount() const;
+
+    /**
+     * @brief Écrit la trace au format JSON (tableau traceEvents avec noms de pistes)
+     * @param out Flux de sortie
+     */
+    void writeJson(std::ostream& out) const;
+};
+
+/**
+ * @brief Trace la durée d'une portée (si le traceur est démarré)
+ */
+class TraceSpan {
+private:
+    Tracer::Event m_event;
+    bool m_active;
+
+public:
+    /**
+     * @brief Constructeur
+     * @param name Nom de la portée (chaîne statique)
+     * @param category Catégorie (chaîne statique)
+     */
+    TraceSpan(const char* name, const char* category)
+        : m_active(Tracer::isEnabled())
+    {
+        if (m_active) {
+            m_event.name = name;
+            m_event.category = category;
+            m_event.argCount = 0;
+            m_event.start = Tracer::instance().now();
+        }
+    }
+
+    ~TraceSpan() {
+        if (m_active) {
+            Tracer& tracer = Tracer::instance();
+            m_event.duration = tracer.now() - m_event.start;
+            m_event.track = tracer.currentTrack();
+            tracer.record(m_event);
+        }
+    }
+
+    /**
+     * @brief Ajoute un argument affiché avec l'événement (deux au plus)
+     * @param name Nom de l'argument (chaîne statique)
+     * @param value Valeur
+     */
+    void addArg(const char* name, long long value) {
+        if (m_active && m_event.argCount < 2) {
+            m_event.argNames[m_event.argCount] = name;
+            m_event.argValues[m_event.argCount] = value;
+            ++m_event.argCount;
+        }
+    }
+
+    TraceSpan(const TraceSpan&) = delete;
+    TraceSpan& operator=(const TraceSpan&) = delete;
+};
+
+#endif // TRACER_HPP
@@ -0,0 +1,77 @@
+#ifndef TRIPLEBUFFER_HPP
+#define TRIPLEBUFFER_HPP
+
+#include <atomic>
+
+/**
+ * @brief Triple tampon sans verrou entre un producteur et un consommateur
+ *
+ * Le producteur remplit back() puis publie ; le consommateur récupère la dernière valeur
+ * publiée avec fetch() et la lit dans front(). Aucun des deux n'attend l'autre : une valeur
+ * publiée mais pas encore récupérée est remplacée par la suivante (le consommateur voit
+ * toujours la plus récente). Chaque côté doit rester sur un seul thread.
+ */
+template <typename T>
+class TripleBuffer {
+private:
+    static constexpr unsigned int INDEX_MASK = 3;
+    static constexpr unsigned int FRESH = 4;    ///< Valeur du milieu publiée et pas encore récupérée
+
+    T m_buffers[3];
+    std::atomic<unsigned int> m_middle;         ///< Index du tampon échangé (+ FRESH)
+    unsigned int m_back;                        ///< Tampon du producteur
+    unsigned int m_front;                       ///< Tampon du consommateur
+
+public:
+    TripleBuffer()
+        : m_middle(1)
+        , m_back(0)
+        , m_front(2)
+    {
+    }
+
+    TripleBuffer(const TripleBuffer&) = delete;
+    TripleBuffer& operator=(const TripleBuffer&) = delete;
+
+    /**
+     * @brief Tampon à remplir par le producteur
+     */
+    T& back() { return m_buffers[m_back]; }
+
+    /**
+     * @brief Publie back() et récupère un autre tampon à remplir
+     * @return false si la publication précédente n'avait pas été récupérée : elle est
+     *         abandonnée et se trouve désormais dans back()
+     */
+    bool publish() {
+        unsigned int previous = m_middle.exchange(m_back | FRESH, std::memory_order_acq_rel);
+        m_back = previous & INDEX_MASK;
+        return (previous & FRESH) == 0;
+    }
+
+    /**
+     * @brief Vrai si la dernière publication n'a pas encore été récupérée
+     *
+     * Côté producteur, un résultat false est définitif jusqu'à la publication suivante.
+     */
+    bool pending() const { return (m_middle.load(std::memory_order_acquire) & FRESH) != 0; }
+
+    /**
+     * @brief Récupère la dernière valeur publiée dans front()
+     * @return true si une nouvelle valeur a été récupérée
+     */
+    bool fetch() {
+        if ((m_middle.load(std::memory_order_acquire) & FRESH) == 0) return false;
+        unsigned int previous = m_middle.exchange(m_front, std::memory_order_acq_rel);
+        m_front = previous & INDEX_MASK;
+        return true;
+    }
+
+    /**
+     * @brief Dernière valeur récupérée par le consommateur
+     */
+    const T& front() const { return m_buffers[m_front]; }
+    T& front() { return m_buffers[m_front]; }
+};
+
+#endif // TRIPLEBUFFER_HPP
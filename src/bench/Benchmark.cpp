@@ -0,0 +1,142 @@
+#include "bench/Benchmark.hpp"
+#include "util/CounterRng.hpp"
+#include <chrono>
+#include <algorithm>
+#include <numeric>
+#include <iomanip>
+#include <sstream>
+
+Benchmark::Benchmark(int warmup, int repetitions)
+    : m_warmup(std::max(warmup, 0))
+    , m_repetitions(std::max(repetitions, 1))
+    , m_counters(nullptr)
+{
+}
+
+BenchmarkResult Benchmark::measure(const BenchmarkCase& params, double cellsPerRun,
+                                   const std::function<void()>& run,
+                                   const std::function<void()>& setup) const {
+    for (int i = 0; i < m_warmup; ++i) {
+        if (setup) setup();
+        run();
+    }
+
+    BenchmarkResult result;
+    std::vector<double> durations;
+    durations.reserve(m_repetitions);
+    bool countersValid[PerfSample::EVENT_COUNT];
+    std::fill(countersValid, countersValid + PerfSample::EVENT_COUNT, true);
+    for (int i = 0; i < m_repetitions; ++i) {
+        if (setup) setup();
+        // Les compteurs encadrent le chronométrage : leur lecture n'est pas chronométrée
+        if (m_counters) m_counters->start();
+        auto start = std::chrono::steady_clock::now();
+        run();
+        durations.push_back(std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+        if (m_counters) {
+            PerfSample sample = m_counters->stop();
+            for (int e = 0; e < PerfSample::EVENT_COUNT; ++e) {
+                result.counters.values[e] += sample.values[e] / m_repetitions;
+                countersValid[e] = countersValid[e] && sample.valid[e];
+            }
+        }
+    }
+    if (m_counters) {
+        for (int e = 0; e < PerfSample::EVENT_COUNT; ++e) {
+            result.counters.valid[e] = countersValid[e];
+            result.hasCounters = result.hasCounters || countersValid[e];
+        }
+    }
+
+    std::sort(durations.begin(), durations.end());
+    result.params = params;
+    result.cellsPerRun = cellsPerRun;
+    result.repetitions = m_repetitions;
+    result.minSeconds = durations.front();
+    size_t middle = durations.size() / 2;
+    result.medianSeconds = (durations.size() % 2 == 1) ? durations[middle]
+                                                        : (durations[middle - 1] + durations[middle]) / 2.0;
+    result.meanSeconds = std::accumulate(durations.begin(), durations.end(), 0.0) / durations.size();
+    result.cellsPerSecond = result.medianSeconds > 0.0 ? cellsPerRun / result.medianSeconds : 0.0;
+    return result;
+}
+
+std::unique_ptr<Grid> Benchmark::makeRandomGrid(int width, int height, double density, bool toroidal,
+                                                std::uint64_t seed) {
+    std::vector<std::uint8_t> codes(static_cast<size_t>(width) * height);
+    const std::uint64_t threshold = static_cast<std::uint64_t>(density * 4294967296.0);
+    CounterRng rng(seed, 0);
+    for (auto& code : codes) {
+        code = (rng.next() < threshold) ? 1 : 0;
+    }
+    return std::make_unique<Grid>(width, height, codes, toroidal);
+}
+
+void Benchmark::printHeader(std::ostream& out) {
+    out << std::left << std::setw(22) << "benchmark"
+        << std::setw(12) << "taille"
+        << std::setw(9) << "densité"
+        << std::setw(8) << "torique"
+        << std::setw(9) << "threads"
+        << std::right << std::setw(13) << "médiane (ms)"
+        << std::setw(12) << "min (ms)"
+        << std::setw(14) << "Mcellules/s" << "\n";
+}
+
+void Benchmark::printResult(std::ostream& out, const BenchmarkResult& result) {
+    const BenchmarkCase& p = result.params;
+    std::string size = std::to_string(p.width) + "x" + std::to_string(p.height);
+    std::ostringstream density;
+    density << std::fixed << std::setprecision(2) << p.density;
+
+    out << std::left << std::setw(22) << p.name
+        << std::setw(12) << size
+        << std::setw(9) << density.str()
+        << std::setw(8) << (p.toroidal ? "oui" : "non")
+        << std::setw(9) << p.threads
+        << std::right << std::fixed << std::setprecision(3)
+        << std::setw(13) << result.medianSeconds * 1000.0
+        << std::setw(12) << result.minSeconds * 1000.0
+        << std::setprecision(2) << std::setw(14) << result.cellsPerSecond / 1e6 << "\n";
+    out.unsetf(std::ios::fixed);
+}
+
+void Benchmark::printCounters(std::ostream& out, const BenchmarkResult& result) {
+    if (!result.hasCounters || result.cellsPerRun <= 0.0) return;
+    const PerfSample& c = result.counters;
+
+    out << "    par cellule:" << std::fixed << std::setprecision(3);
+    for (int e = 0; e < PerfSample::EVENT_COUNT; ++e) {
+        if (c.valid[e]) {
+            out << ' ' << PerfCounters::getEventName(static_cast<PerfCounters::Event>(e))
+                << '=' << c.values[e] / result.cellsPerRun;
+        }
+    }
+    if (c.valid[PerfCounters::Cycles] && c.valid[PerfCounters::Instructions] && c.values[PerfCounters::Cycles] > 0.0) {
+        out << "  IPC=" << std::setprecision(2) << c.values[PerfCounters::Instructions] / c.values[PerfCounters::Cycles];
+    }
+    out << "\n";
+    out.unsetf(std::ios::fixed);
+}
+
+void Benchmark::writeCsv(std::ostream& out, const std::vector<BenchmarkResult>& results) {
+    out << "benchmark,width,height,density,toroidal,threads,repetitions,median_s,min_s,mean_s,cells_per_s";
+    for (int e = 0; e < PerfSample::EVENT_COUNT; ++e) {
+        out << ',' << PerfCounters::getEventName(static_cast<PerfCounters::Event>(e)) << "_per_cell";
+    }
+    out << '\n';
+    for (const auto& result : results) {
+        const BenchmarkCase& p = result.params;
+        out << p.name << ',' << p.width << ',' << p.height << ',' << p.density << ','
+            << (p.toroidal ? 1 : 0) << ',' << p.threads << ',' << result.repetitions << ','
+            << result.medianSeconds << ',' << result.minSeconds << ',' << result.meanSeconds << ','
+            << result.cellsPerSecond;
+        for (int e = 0; e < PerfSample::EVENT_COUNT; ++e) {
+            out << ',';
+            if (result.counters.valid[e] && result.cellsPerRun > 0.0) {
+                out << result.counters.values[e] / result.cellsPerRun;
+            }
+        }
+        out << '\n';
+    }
+}
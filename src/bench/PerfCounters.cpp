@@ -0,0 +1,131 @@
+#include "bench/PerfCounters.hpp"
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#include <cstdint>
+#endif
+
+namespace {
+
+#ifdef __linux__
+/**
+ * @brief Ouvre un compteur désactivé pour le thread courant et les threads qu'il crée
+ */
+int openCounter(std::uint32_t type, std::uint64_t config) {
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = type;
+    attr.config = config;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.inherit = 1;
+    attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+}
+
+/**
+ * @brief Lit la valeur, le temps activé et le temps effectivement compté (multiplexage)
+ */
+bool readCounter(int fd, std::uint64_t data[3]) {
+    return read(fd, data, 3 * sizeof(std::uint64_t)) == static_cast<ssize_t>(3 * sizeof(std::uint64_t));
+}
+#endif
+
+} // namespace
+
+PerfCounters::PerfCounters()
+    : m_start()
+    , m_startValid()
+{
+    for (int& fd : m_fds) fd = -1;
+
+#ifdef __linux__
+    const std::uint64_t tlbReadMiss = PERF_COUNT_HW_CACHE_DTLB
+                                    | (PERF_COUNT_HW_CACHE_OP_READ << 8)
+                                    | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+    struct { std::uint32_t type; std::uint64_t config; } events[EventCount] = {
+        {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+        {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+        {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+        {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+        {PERF_TYPE_HW_CACHE, tlbReadMiss}
+    };
+
+    for (int i = 0; i < EventCount; ++i) {
+        m_fds[i] = openCounter(events[i].type, events[i].config);
+        if (m_fds[i] < 0 && m_error.empty()) {
+            m_error = std::string("perf_event_open(") + getEventName(static_cast<Event>(i)) + "): "
+                    + std::strerror(errno);
+        }
+    }
+#else
+    m_error = "hardware counters require Linux perf_event_open";
+#endif
+}
+
+PerfCounters::~PerfCounters() {
+#ifdef __linux__
+    for (int fd : m_fds) {
+        if (fd >= 0) close(fd);
+    }
+#endif
+}
+
+bool PerfCounters::isAvailable() const {
+    for (int fd : m_fds) {
+        if (fd >= 0) return true;
+    }
+    return false;
+}
+
+const char* PerfCounters::getEventName(Event event) {
+    switch (event) {
+        case Cycles: return "cycles";
+        case Instructions: return "instructions";
+        case CacheMisses: return "cache-misses";
+        case BranchMisses: return "branch-misses";
+        case TlbMisses: return "dtlb-misses";
+        default: return "unknown";
+    }
+}
+
+void PerfCounters::start() {
+#ifdef __linux__
+    // Pas de remise à zéro : elle n'efface pas les comptes hérités des threads terminés
+    for (int i = 0; i < EventCount; ++i) {
+        if (m_fds[i] < 0) continue;
+        m_startValid[i] = readCounter(m_fds[i], m_start[i]);
+        ioctl(m_fds[i], PERF_EVENT_IOC_ENABLE, 0);
+    }
+#endif
+}
+
+PerfSample PerfCounters::stop() {
+    PerfSample sample;
+#ifdef __linux__
+    for (int fd : m_fds) {
+        if (fd >= 0) ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+    }
+    for (int i = 0; i < EventCount; ++i) {
+        if (m_fds[i] < 0 || !m_startValid[i]) continue;
+
+        // Progression depuis start(), corrigée du multiplexage sur cette seule période
+        std::uint64_t data[3] = {0, 0, 0};
+        if (!readCounter(m_fds[i], data)) continue;
+        const std::uint64_t value = data[0] - m_start[i][0];
+        const std::uint64_t enabled = data[1] - m_start[i][1];
+        const std::uint64_t running = data[2] - m_start[i][2];
+        if (running == 0) continue;
+        sample.values[i] = static_cast<double>(value) * static_cast<double>(enabled) / static_cast<double>(running);
+        sample.valid[i] = true;
+    }
+#endif
+    return sample;
+}
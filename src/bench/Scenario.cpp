@@ -0,0 +1,326 @@
+#include "bench/Scenario.hpp"
+#include "game/Game.hpp"
+#include "game/BatchRunner.hpp"
+#include "rules/ClassicRule.hpp"
+#include "io/FileHandler.hpp"
+#include "patterns/Patterns.hpp"
+#include "util/CounterRng.hpp"
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <algorithm>
+#include <stdexcept>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+/**
+ * @brief Construit la grille initiale d'un scénario soup ou fleet
+ */
+std::unique_ptr<Grid> makeScenarioGrid(const Scenario& scenario) {
+    if (scenario.kind == "fleet") {
+        Patterns::Pattern pattern = Patterns::getByName(scenario.pattern);
+        if (pattern.empty()) {
+            throw std::runtime_error("Unknown pattern: " + scenario.pattern);
+        }
+        auto grid = std::make_unique<Grid>(scenario.width, scenario.height, scenario.toroidal);
+        for (int y = 0; y + static_cast<int>(pattern.size()) <= scenario.height; y += scenario.spacing) {
+            for (int x = 0; x + static_cast<int>(pattern[0].size()) <= scenario.width; x += scenario.spacing) {
+                grid->placePattern(pattern, x, y);
+            }
+        }
+        return grid;
+    }
+
+    // Soupe : un tirage pour l'obstacle, un pour l'état (vivant ou mort)
+    std::vector<std::uint8_t> codes(static_cast<size_t>(scenario.width) * scenario.height);
+    const std::uint64_t aliveThreshold = static_cast<std::uint64_t>(scenario.density * 4294967296.0);
+    const std::uint64_t obstacleThreshold = static_cast<std::uint64_t>(scenario.obstacles * 4294967296.0);
+    CounterRng rng(scenario.seed, 0);
+    for (auto& code : codes) {
+        bool obstacle = rng.next() < obstacleThreshold;
+        bool alive = rng.next() < aliveThreshold;
+        code = static_cast<std::uint8_t>((obstacle ? 2 : 0) + (alive ? 1 : 0));
+    }
+    return std::make_unique<Grid>(scenario.width, scenario.height, codes, scenario.toroidal);
+}
+
+/**
+ * @brief Exécute un scénario console : simulation complète avec écriture des itérations
+ */
+ScenarioResult runConsole(const Scenario& scenario, ScenarioResult result) {
+    fs::path outputRoot = fs::temp_directory_path() / ("gameoflife_scenario_" + scenario.name);
+
+    BatchOptions options;
+    options.iterations = scenario.generations;
+    options.toroidal = scenario.toroidal;
+    options.writeOutputs = true;
+    options.outputExtension = "." + scenario.format;
+    options.outputRoot = outputRoot.string();
+    options.maxPeriod = 0;
+    options.threadCount = 1;
+    BatchRunner runner(options);
+
+    BatchResult last;
+    Benchmark bench(scenario.warmup, scenario.repetitions);
+    BenchmarkResult timing = bench.measure(
+        BenchmarkCase{scenario.name, 0, 0, 0.0, scenario.toroidal, 1}, 0.0,
+        [&]() { last = runner.run({scenario.file}).front(); },
+        [&]() { fs::remove_all(outputRoot); });
+
+    if (!last.success) {
+        fs::remove_all(outputRoot);
+        throw std::runtime_error("Scenario " + scenario.name + " failed: " + last.error);
+    }
+
+    // L'empreinte est celle de la dernière itération écrite, relue depuis le disque
+    // (comme en mode console, la génération finale elle-même n'est pas écrite)
+    int lastWritten = std::max(last.finalGeneration - 1, 0);
+    auto finalGrid = FileHandler::loadFromFile(
+        FileHandler::getIterationFilename(last.outputDir, lastWritten, options.outputExtension));
+    fs::remove_all(outputRoot);
+
+    result.width = last.width;
+    result.height = last.height;
+    result.generations = last.finalGeneration;
+    result.repetitions = timing.repetitions;
+    result.medianSeconds = timing.medianSeconds;
+    result.minSeconds = timing.minSeconds;
+    result.population = last.population;
+    result.hash = finalGrid->hash();
+    return result;
+}
+
+/**
+ * @brief Découpe une ligne CSV simple (sans guillemets)
+ */
+std::vector<std::string> splitCsv(const std::string& line) {
+    std::vector<std::string> fields;
+    std::istringstream stream(line);
+    std::string field;
+    while (std::getline(stream, field, ',')) {
+        fields.push_back(field);
+    }
+    return fields;
+}
+
+} // namespace
+
+std::vector<Scenario> ScenarioSuite::loadFile(const std::string& filename) {
+    std::ifstream file(filename);
+    if (!file.is_open()) {
+        throw std::runtime_error("Cannot open file: " + filename);
+    }
+
+    fs::path baseDir = fs::path(filename).parent_path();
+    std::vector<Scenario> scenarios;
+    std::string line;
+    int lineNumber = 0;
+    while (std::getline(file, line)) {
+        ++lineNumber;
+        size_t begin = line.find_first_not_of(" \t\r");
+        if (begin == std::string::npos || line[begin] == '#') continue;
+
+        std::istringstream stream(line);
+        Scenario scenario;
+        stream >> scenario.name >> scenario.kind;
+        if (scenario.kind != "soup" && scenario.kind != "file" &&
+            scenario.kind != "fleet" && scenario.kind != "console") {
+            throw std::runtime_error("Invalid scenario file: line " + std::to_string(lineNumber));
+        }
+        for (const auto& other : scenarios) {
+            if (other.name == scenario.name) {
+                throw std::runtime_error("Duplicate scenario name: " + scenario.name);
+            }
+        }
+
+        std::string token;
+        while (stream >> token) {
+            size_t equal = token.find('=');
+            if (equal == std::string::npos) {
+                throw std::runtime_error("Invalid scenario file: line " + std::to_string(lineNumber));
+            }
+            std::string key = token.substr(0, equal);
+            std::string value = token.substr(equal + 1);
+            try {
+                if (key == "size") {
+                    size_t x = value.find('x');
+                    if (x == std::string::npos) throw std::invalid_argument(value);
+                    scenario.width = std::stoi(value.substr(0, x));
+                    scenario.height = std::stoi(value.substr(x + 1));
+                } else if (key == "density") {
+                    scenario.density = std::stod(value);
+                } else if (key == "obstacles") {
+                    scenario.obstacles = std::stod(value);
+                } else if (key == "seed") {
+                    scenario.seed = std::stoull(value);
+                } else if (key == "file") {
+                    fs::path path(value);
+                    scenario.file = path.is_relative() ? (baseDir / path).string() : path.string();
+                } else if (key == "pattern") {
+                    scenario.pattern = value;
+                } else if (key == "spacing") {
+                    scenario.spacing = std::stoi(value);
+                } else if (key == "format") {
+                    scenario.format = value;
+                } else if (key == "generations") {
+                    scenario.generations = std::stoi(value);
+                } else if (key == "toroidal") {
+                    scenario.toroidal = (value == "1" || value == "true");
+                } else if (key == "warmup") {
+                    scenario.warmup = std::stoi(value);
+                } else if (key == "reps") {
+                    scenario.repetitions = std::stoi(value);
+                } else if (key == "threshold") {
+                    scenario.threshold = std::stod(value);
+                } else {
+                    throw std::invalid_argument(key);
+                }
+            } catch (const std::logic_error&) {
+                throw std::runtime_error("Invalid scenario file: line " + std::to_string(lineNumber));
+            }
+        }
+
+        bool needsFile = (scenario.kind == "file" || scenario.kind == "console");
+        if ((needsFile && scenario.file.empty()) || scenario.width <= 0 || scenario.height <= 0 ||
+            scenario.spacing <= 0 || scenario.generations < 0) {
+            throw std::runtime_error("Invalid scenario file: line " + std::to_string(lineNumber));
+        }
+        scenarios.push_back(scenario);
+    }
+    return scenarios;
+}
+
+ScenarioResult ScenarioSuite::run(const Scenario& scenario) {
+    ScenarioResult result;
+    result.name = scenario.name;
+    result.kind = scenario.kind;
+
+    if (scenario.kind == "console") {
+        result = runConsole(scenario, result);
+    } else {
+        std::unique_ptr<Grid> initial = (scenario.kind == "file")
+            ? FileHandler::loadFromFile(scenario.file, scenario.toroidal)
+            : makeScenarioGrid(scenario);
+        result.width = initial->getWidth();
+        result.height = initial->getHeight();
+
+        // Le Game est reconstruit avant chaque exécution, hors chronométrage
+        std::unique_ptr<Game> game;
+        Benchmark bench(scenario.warmup, scenario.repetitions);
+        BenchmarkResult timing = bench.measure(
+            BenchmarkCase{scenario.name, result.width, result.height, scenario.density, scenario.toroidal, 1}, 0.0,
+            [&]() { while (game->step()) {} },
+            [&]() {
+                game = std::make_unique<Game>(std::make_unique<Grid>(*initial), std::make_unique<ClassicRule>(),
+                                              scenario.generations);
+            });
+
+        result.generations = game->getIteration();
+        result.repetitions = timing.repetitions;
+        result.medianSeconds = timing.medianSeconds;
+        result.minSeconds = timing.minSeconds;
+        result.population = game->countAliveCells();
+        result.hash = game->getGrid().hash();
+    }
+
+    double cellUpdates = static_cast<double>(result.width) * result.height * result.generations;
+    result.cellsPerSecond = result.medianSeconds > 0.0 ? cellUpdates / result.medianSeconds : 0.0;
+    return result;
+}
+
+void ScenarioSuite::writeCsv(std::ostream& out, const std::vector<ScenarioResult>& results,
+                             const std::string& prefix, bool withHeader) {
+    const std::string lead = prefix.empty() ? "" : prefix + ",";
+    if (withHeader) {
+        out << "scenario,kind,width,height,generations,repetitions,median_s,min_s,cells_per_s,population,hash\n";
+    }
+    for (const auto& result : results) {
+        out << lead << result.name << ',' << result.kind << ','
+            << result.width << ',' << result.height << ',' << result.generations << ','
+            << result.repetitions << ','
+            << std::setprecision(6) << result.medianSeconds << ',' << result.minSeconds << ','
+            << std::setprecision(4) << result.cellsPerSecond << ','
+            << result.population << ',' << std::hex << result.hash << std::dec << '\n';
+    }
+}
+
+std::map<std::string, ScenarioResult> ScenarioSuite::loadBaseline(const std::string& filename) {
+    std::ifstream file(filename);
+    if (!file.is_open()) {
+        throw std::runtime_error("Cannot open file: " + filename);
+    }
+
+    std::map<std::string, ScenarioResult> baseline;
+    std::string line;
+    int lineNumber = 0;
+    while (std::getline(file, line)) {
+        ++lineNumber;
+        if (!line.empty() && line.back() == '\r') line.pop_back();
+        if (lineNumber == 1 || line.empty()) continue;
+
+        std::vector<std::string> fields = splitCsv(line);
+        if (fields.size() != 11) {
+            throw std::runtime_error("Invalid baseline format: line " + std::to_string(lineNumber));
+        }
+        ScenarioResult result;
+        try {
+            result.name = fields[0];
+            result.kind = fields[1];
+            result.width = std::stoi(fields[2]);
+            result.height = std::stoi(fields[3]);
+            result.generations = std::stoi(fields[4]);
+            result.repetitions = std::stoi(fields[5]);
+            result.medianSeconds = std::stod(fields[6]);
+            result.minSeconds = std::stod(fields[7]);
+            result.cellsPerSecond = std::stod(fields[8]);
+            result.population = std::stoi(fields[9]);
+            result.hash = std::stoull(fields[10], nullptr, 16);
+        } catch (const std::logic_error&) {
+            throw std::runtime_error("Invalid baseline format: line " + std::to_string(lineNumber));
+        }
+        baseline[result.name] = result;
+    }
+    return baseline;
+}
+
+std::vector<ScenarioComparison> ScenarioSuite::compare(const std::vector<ScenarioResult>& results,
+                                                       const std::vector<Scenario>& scenarios,
+                                                       const std::map<std::string, ScenarioResult>& baseline,
+                                                       double defaultThreshold) {
+    std::vector<ScenarioComparison> comparisons;
+    for (const auto& result : results) {
+        ScenarioComparison comparison;
+        comparison.name = result.name;
+        comparison.currentSeconds = result.medianSeconds;
+        comparison.threshold = defaultThreshold;
+        for (const auto& scenario : scenarios) {
+            if (scenario.name == result.name && scenario.threshold >= 0.0) {
+                comparison.threshold = scenario.threshold;
+            }
+        }
+
+        auto it = baseline.find(result.name);
+        if (it == baseline.end()) {
+            comparison.status = ScenarioComparison::Status::New;
+        } else {
+            const ScenarioResult& reference = it->second;
+            comparison.baselineSeconds = reference.medianSeconds;
+            comparison.changePercent = reference.medianSeconds > 0.0
+                ? (result.medianSeconds / reference.medianSeconds - 1.0) * 100.0 : 0.0;
+
+            if (reference.generations != result.generations || reference.population != result.population ||
+                (reference.hash != 0 && result.hash != 0 && reference.hash != result.hash)) {
+                comparison.status = ScenarioComparison::Status::Mismatch;
+            } else if (comparison.changePercent > comparison.threshold) {
+                comparison.status = ScenarioComparison::Status::Regression;
+            } else {
+                comparison.status = ScenarioComparison::Status::Ok;
+            }
+        }
+        comparisons.push_back(comparison);
+    }
+    return comparisons;
+}
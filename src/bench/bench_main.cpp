@@ -0,0 +1,362 @@
+/**
+ * @file bench_main.cpp
+ * @brief Micro-benchmarks du moteur du Jeu de la Vie
+ * 
+ * Mesure les opérations élémentaires (mise à jour de la grille, comptage des voisins,
+ * itération complète, comparaison, copie, lecture/écriture de fichiers) sur une matrice
+ * de tailles, densités, topologies et nombres de threads. Le mode --scenarios exécute
+ * des scénarios de bout en bout et les compare à une référence CSV.
+ */
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <sstream>
+#include <cstdlib>
+#include <cstdio>
+#include <thread>
+#include <algorithm>
+#include <iomanip>
+#include <map>
+#include <memory>
+#include <chrono>
+#include <ctime>
+#include "bench/Benchmark.hpp"
+#include "bench/Scenario.hpp"
+#include "game/Game.hpp"
+#include "rules/ClassicRule.hpp"
+#include "io/FileHandler.hpp"
+
+void printUsage(const char* programName) {
+    std::cout << "Jeu de la Vie - Benchmarks\n";
+    std::cout << "==========================\n\n";
+    std::cout << "Usage: " << programName << " [options]\n\n";
+    std::cout << "Options:\n";
+    std::cout << "  --sizes <liste>      Côtés des grilles carrées (défaut: 64,256,1024)\n";
+    std::cout << "  --densities <liste>  Densités initiales (défaut: 0.1,0.5)\n";
+    std::cout << "  --threads <liste>    Nombres de threads (défaut: 1,2,4 et le nombre de cœurs)\n";
+    std::cout << "  --warmup <n>         Exécutions d'échauffement (défaut: 2)\n";
+    std::cout << "  --reps <n>           Exécutions mesurées (défaut: 5)\n";
+    std::cout << "  --filter <texte>     Ne lancer que les benchmarks dont le nom contient <texte>\n";
+    std::cout << "  --quick              Matrice réduite (tailles 32,128 ; 3 mesures)\n";
+    std::cout << "  --csv <fichier>      Écrire les résultats au format CSV\n";
+    std::cout << "  --counters           Compteurs matériels par cellule (cycles, instructions, défauts\n";
+    std::cout << "                       de cache, de prédiction et de TLB ; Linux, perf_event_open)\n";
+    std::cout << "  -h                   Afficher cette aide\n\n";
+    std::cout << "Scénarios de bout en bout:\n";
+    std::cout << "  --scenarios <fichier>  Exécuter les scénarios du fichier (ex: examples/scenarios.cfg)\n";
+    std::cout << "  --baseline <csv>       Comparer à une référence écrite par --csv\n";
+    std::cout << "  --threshold <pct>      Ralentissement toléré en % (défaut: 10)\n";
+    std::cout << "  --history <csv>        Ajouter les résultats à un historique (date, étiquette)\n";
+    std::cout << "  --label <texte>        Étiquette de l'historique (ex: version)\n";
+    std::cout << "  --filter et --csv s'appliquent aussi aux scénarios\n";
+}
+
+/**
+ * @brief Exécute les scénarios de bout en bout
+ * @return Code de sortie (1 en cas de régression ou de résultat différent de la référence)
+ */
+int runScenarios(const std::string& scenarioFile, const std::string& filter, const std::string& csvFile,
+                 const std::string& baselineFile, double threshold,
+                 const std::string& historyFile, const std::string& label) {
+    try {
+        std::vector<Scenario> scenarios = ScenarioSuite::loadFile(scenarioFile);
+        std::map<std::string, ScenarioResult> baseline;
+        if (!baselineFile.empty()) {
+            baseline = ScenarioSuite::loadBaseline(baselineFile);
+        }
+
+        std::vector<ScenarioResult> results;
+        std::cout << std::left << std::setw(20) << "scénario" << std::setw(10) << "type"
+                  << std::setw(12) << "taille" << std::right << std::setw(12) << "générations"
+                  << std::setw(14) << "médiane (s)" << std::setw(14) << "Mcellules/s"
+                  << std::setw(12) << "population" << "\n";
+        for (const auto& scenario : scenarios) {
+            if (!filter.empty() && scenario.name.find(filter) == std::string::npos) continue;
+            ScenarioResult result = ScenarioSuite::run(scenario);
+            std::cout << std::left << std::setw(20) << result.name << std::setw(10) << result.kind
+                      << std::setw(12) << (std::to_string(result.width) + "x" + std::to_string(result.height))
+                      << std::right << std::setw(12) << result.generations
+                      << std::fixed << std::setprecision(3) << std::setw(14) << result.medianSeconds
+                      << std::setprecision(2) << std::setw(14) << result.cellsPerSecond / 1e6
+                      << std::setw(12) << result.population << "\n";
+            std::cout.unsetf(std::ios::fixed);
+            std::cout.flush();
+            results.push_back(result);
+        }
+
+        if (!csvFile.empty()) {
+            std::ofstream csv(csvFile);
+            if (!csv.is_open()) {
+                std::cerr << "Erreur: Impossible de créer " << csvFile << "\n";
+                return 1;
+            }
+            ScenarioSuite::writeCsv(csv, results);
+            std::cout << "\nRésultats CSV: " << csvFile << "\n";
+        }
+
+        if (!historyFile.empty()) {
+            bool exists = std::ifstream(historyFile).good();
+            std::ofstream history(historyFile, std::ios::app);
+            if (!history.is_open()) {
+                std::cerr << "Erreur: Impossible d'écrire " << historyFile << "\n";
+                return 1;
+            }
+            std::time_t now = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
+            char date[32];
+            std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", std::localtime(&now));
+            if (!exists) history << "date,label,";
+            ScenarioSuite::writeCsv(history, results, std::string(date) + "," + label, !exists);
+            std::cout << "Historique: " << historyFile << "\n";
+        }
+
+        if (baselineFile.empty()) return 0;
+
+        int failures = 0;
+        std::cout << "\nComparaison avec " << baselineFile << "\n";
+        std::cout << std::left << std::setw(20) << "scénario" << std::right << std::setw(16) << "référence (s)"
+                  << std::setw(14) << "actuel (s)" << std::setw(10) << "écart" << std::setw(9) << "seuil"
+                  << "  état\n";
+        for (const auto& comparison : ScenarioSuite::compare(results, scenarios, baseline, threshold)) {
+            std::string status;
+            switch (comparison.status) {
+                case ScenarioComparison::Status::Ok: status = "OK"; break;
+                case ScenarioComparison::Status::Regression: status = "RÉGRESSION"; ++failures; break;
+                case ScenarioComparison::Status::Mismatch: status = "RÉSULTAT DIFFÉRENT"; ++failures; break;
+                case ScenarioComparison::Status::New: status = "nouveau"; break;
+            }
+            std::cout << std::left << std::setw(20) << comparison.name << std::right << std::fixed
+                      << std::setprecision(3) << std::setw(16) << comparison.baselineSeconds
+                      << std::setw(14) << comparison.currentSeconds
+                      << std::showpos << std::setprecision(1) << std::setw(9) << comparison.changePercent << "%"
+                      << std::noshowpos << std::setw(8) << comparison.threshold << "%"
+                      << "  " << status << "\n";
+            std::cout.unsetf(std::ios::fixed);
+        }
+        return failures > 0 ? 1 : 0;
+    } catch (const std::exception& e) {
+        std::cerr << "Erreur: " << e.what() << "\n";
+        return 1;
+    }
+}
+
+/**
+ * @brief Découpe une liste séparée par des virgules
+ */
+template <typename T>
+std::vector<T> parseList(const std::string& text) {
+    std::vector<T> values;
+    std::istringstream stream(text);
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+        std::istringstream itemStream(item);
+        T value;
+        if (itemStream >> value) values.push_back(value);
+    }
+    return values;
+}
+
+int main(int argc, char* argv[]) {
+    std::vector<int> sizes = {64, 256, 1024};
+    std::vector<double> densities = {0.1, 0.5};
+    std::vector<unsigned int> threadCounts;
+    int warmup = 2;
+    int repetitions = 5;
+    std::string filter;
+    std::string csvFile;
+    std::string scenarioFile;
+    std::string baselineFile;
+    std::string historyFile;
+    std::string label;
+    double threshold = 10.0;
+    bool useCounters = false;
+    
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "-h" || arg == "--help") {
+            printUsage(argv[0]);
+            return 0;
+        } else if (arg == "--sizes" && i + 1 < argc) {
+            sizes = parseList<int>(argv[++i]);
+        } else if (arg == "--densities" && i + 1 < argc) {
+            densities = parseList<double>(argv[++i]);
+        } else if (arg == "--threads" && i + 1 < argc) {
+            threadCounts = parseList<unsigned int>(argv[++i]);
+        } else if (arg == "--warmup" && i + 1 < argc) {
+            warmup = std::atoi(argv[++i]);
+        } else if (arg == "--reps" && i + 1 < argc) {
+            repetitions = std::atoi(argv[++i]);
+        } else if (arg == "--filter" && i + 1 < argc) {
+            filter = argv[++i];
+        } else if (arg == "--quick") {
+            sizes = {32, 128};
+            repetitions = 3;
+        } else if (arg == "--csv" && i + 1 < argc) {
+            csvFile = argv[++i];
+        } else if (arg == "--counters") {
+            useCounters = true;
+        } else if (arg == "--scenarios" && i + 1 < argc) {
+            scenarioFile = argv[++i];
+        } else if (arg == "--baseline" && i + 1 < argc) {
+            baselineFile = argv[++i];
+        } else if (arg == "--threshold" && i + 1 < argc) {
+            threshold = std::atof(argv[++i]);
+        } else if (arg == "--history" && i + 1 < argc) {
+            historyFile = argv[++i];
+        } else if (arg == "--label" && i + 1 < argc) {
+            label = argv[++i];
+        } else {
+            std::cerr << "Option inconnue: " << arg << "\n";
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+    
+    if (!scenarioFile.empty()) {
+        return runScenarios(scenarioFile, filter, csvFile, baselineFile, threshold, historyFile, label);
+    }
+    
+    if (threadCounts.empty()) {
+        unsigned int cores = std::thread::hardware_concurrency();
+        threadCounts = {1, 2, 4};
+        if (cores > 4) threadCounts.push_back(cores);
+    }
+    threadCounts.erase(std::remove(threadCounts.begin(), threadCounts.end(), 0u), threadCounts.end());
+    sizes.erase(std::remove_if(sizes.begin(), sizes.end(), [](int size) { return size <= 0; }), sizes.end());
+    
+    Benchmark bench(warmup, repetitions);
+    std::unique_ptr<PerfCounters> counters;
+    if (useCounters) {
+        counters = std::make_unique<PerfCounters>();
+        if (!counters->isAvailable()) {
+            std::cout << "Compteurs matériels indisponibles (" << counters->getError() << "), mesure du temps seul.\n";
+            counters.reset();
+        } else {
+            if (!counters->getError().empty()) {
+                std::cout << "Certains compteurs sont indisponibles: " << counters->getError() << "\n";
+            }
+            bench.setCounters(counters.get());
+        }
+    }
+    ClassicRule rule;
+    std::vector<BenchmarkResult> results;
+    
+    auto enabled = [&filter](const std::string& name) {
+        return filter.empty() || name.find(filter) != std::string::npos;
+    };
+    auto record = [&results](const BenchmarkResult& result) {
+        Benchmark::printResult(std::cout, result);
+        Benchmark::printCounters(std::cout, result);
+        std::cout.flush();
+        results.push_back(result);
+    };
+    
+    std::cout << "Échauffement: " << bench.getWarmup() << ", mesures: " << bench.getRepetitions()
+              << ", cœurs: " << std::thread::hardware_concurrency() << "\n\n";
+    Benchmark::printHeader(std::cout);
+    
+    for (int size : sizes) {
+        const double cells = static_cast<double>(size) * size;
+        for (double density : densities) {
+            for (bool toroidal : {false, true}) {
+                BenchmarkCase params{"", size, size, density, toroidal, 1};
+                
+                // Mise à jour d'une génération, séquentielle puis parallèle
+                if (enabled("Grid::update")) {
+                    for (unsigned int threads : threadCounts) {
+                        auto grid = Benchmark::makeRandomGrid(size, size, density, toroidal);
+                        params.name = "Grid::update";
+                        params.threads = threads;
+                        record(bench.measure(params, cells, [&]() {
+                            grid->update(rule, threads > 1, threads);
+                        }));
+                    }
+                }
+                
+                params.threads = 1;
+                if (enabled("countAliveNeighbors")) {
+                    auto grid = Benchmark::makeRandomGrid(size, size, density, toroidal);
+                    volatile long long sink = 0;
+                    params.name = "countAliveNeighbors";
+                    record(bench.measure(params, cells, [&]() {
+                        long long total = 0;
+                        for (int y = 0; y < size; ++y) {
+                            for (int x = 0; x < size; ++x) {
+                                total += grid->countAliveNeighbors(x, y);
+                            }
+                        }
+                        sink = sink + total;
+                    }));
+                }
+                
+                // Itération complète : copie de la grille précédente, mise à jour, test de stabilité
+                if (enabled("Game::step")) {
+                    for (unsigned int threads : threadCounts) {
+                        Game game(Benchmark::makeRandomGrid(size, size, density, toroidal),
+                                  std::make_unique<ClassicRule>(), 0);
+                        game.setParallel(threads > 1);
+                        game.setThreadCount(threads);
+                        params.name = "Game::step";
+                        params.threads = threads;
+                        record(bench.measure(params, cells, [&]() { game.step(); }));
+                    }
+                }
+                
+                // Les opérations suivantes ne dépendent pas de la topologie
+                if (toroidal) continue;
+                params.threads = 1;
+                
+                if (enabled("Grid::equals")) {
+                    auto grid = Benchmark::makeRandomGrid(size, size, density, false);
+                    Grid copy(*grid);
+                    volatile bool sink = false;
+                    params.name = "Grid::equals";
+                    record(bench.measure(params, cells, [&]() { sink = grid->equals(copy); }));
+                }
+                
+                if (enabled("Grid copy")) {
+                    auto grid = Benchmark::makeRandomGrid(size, size, density, false);
+                    params.name = "Grid copy";
+                    record(bench.measure(params, cells, [&]() { Grid copy(*grid); }));
+                }
+                
+                if (enabled("Grid assign")) {
+                    auto grid = Benchmark::makeRandomGrid(size, size, density, false);
+                    auto other = Benchmark::makeRandomGrid(size, size, density, false, 2);
+                    std::vector<std::uint8_t> otherCodes = other->toCodes();
+                    params.name = "Grid assign";
+                    record(bench.measure(params, cells,
+                                         [&]() { *other = *grid; },
+                                         [&]() { other->fromCodes(otherCodes); }));
+                }
+                
+                const std::string path = "bench_grid.txt";
+                if (enabled("FileHandler::save")) {
+                    auto grid = Benchmark::makeRandomGrid(size, size, density, false);
+                    params.name = "FileHandler::save";
+                    record(bench.measure(params, cells, [&]() { FileHandler::saveToFile(*grid, path); }));
+                }
+                
+                if (enabled("FileHandler::load")) {
+                    FileHandler::saveToFile(*Benchmark::makeRandomGrid(size, size, density, false), path);
+                    params.name = "FileHandler::load";
+                    record(bench.measure(params, cells, [&]() { FileHandler::loadFromFile(path); }));
+                }
+                std::remove(path.c_str());
+            }
+        }
+    }
+    
+    if (!csvFile.empty()) {
+        std::ofstream csv(csvFile);
+        if (!csv.is_open()) {
+            std::cerr << "Erreur: Impossible de créer " << csvFile << "\n";
+            return 1;
+        }
+        Benchmark::writeCsv(csv, results);
+        std::cout << "\nRésultats CSV: " << csvFile << "\n";
+    }
+    
+    return 0;
+}
@@ -1,7 +1,22 @@
 #include "cell/CellState.hpp"
+#include "cell/AliveState.hpp"
+#include "cell/DeadState.hpp"
+#include "cell/ObstacleAliveState.hpp"
+#include "cell/ObstacleDeadState.hpp"
 
-// Fichier d'implémentation pour CellState
-// La classe est abstraite, pas d'implémentation nécessaire ici
-
-
+// La classe est abstraite : seule la fabrique à partir d'un code est implémentée ici
 
+std::unique_ptr<CellState> CellState::fromCode(int code) {
+    switch (code) {
+        case 0:
+            return std::make_unique<DeadState>();
+        case 1:
+            return std::make_unique<AliveState>();
+        case 2:
+            return std::make_unique<ObstacleDeadState>();
+        case 3:
+            return std::make_unique<ObstacleAliveState>();
+        default:
+            return nullptr;
+    }
+}
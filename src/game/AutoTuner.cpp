@@ -0,0 +1,262 @@
+#include "game/AutoTuner.hpp"
+#include "game/SoupRunner.hpp"
+#include "grid/Grid.hpp"
+#include "rules/ClassicRule.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+
+std::string TuningConfig::describe() const {
+    if (!parallel) return "séquentiel";
+    std::string text = "parallèle " + std::to_string(threads) + " threads";
+    text += bandRows > 0 ? ", bandes de " + std::to_string(bandRows) + " lignes" : ", une bande par thread";
+    return text;
+}
+
+std::string TuningProfile::defaultPath() {
+    const char* path = std::getenv("GAMEOFLIFE_TUNING");
+    return (path != nullptr && *path != '\0') ? path : "gameoflife_tuning.cfg";
+}
+
+TuningProfile TuningProfile::load(const std::string& path) {
+    TuningProfile profile;
+    std::ifstream file(path);
+    if (!file.is_open()) return profile;
+
+    std::string line;
+    int lineNumber = 0;
+    while (std::getline(file, line)) {
+        ++lineNumber;
+        if (line.empty() || line[0] == '#') continue;
+
+        Entry entry;
+        std::istringstream tokens(line);
+        std::string token;
+        int fields = 0;
+        while (tokens >> token) {
+            size_t separator = token.find('=');
+            if (separator == std::string::npos) {
+                throw std::runtime_error("Invalid tuning profile: line " + std::to_string(lineNumber));
+            }
+            std::string key = token.substr(0, separator);
+            std::string value = token.substr(separator + 1);
+            try {
+                if (key == "cells") {
+                    // "2^16" ou "16"
+                    entry.sizeClass = std::stoi(value.compare(0, 2, "2^") == 0 ? value.substr(2) : value);
+                } else if (key == "density") {
+                    entry.densityClass = densityClass(std::stod(value));
+                } else if (key == "toroidal") {
+                    entry.toroidal = value == "1";
+                } else if (key == "parallel") {
+                    entry.config.parallel = value == "1";
+                } else if (key == "threads") {
+                    entry.config.threads = static_cast<unsigned int>(std::stoul(value));
+                } else if (key == "band") {
+                    entry.config.bandRows = std::stoi(value);
+                } else if (key == "rate") {
+                    entry.config.cellsPerSecond = std::stod(value);
+                } else {
+                    throw std::invalid_argument(key);
+                }
+            } catch (const std::exception&) {
+                throw std::runtime_error("Invalid tuning profile: line " + std::to_string(lineNumber));
+            }
+            ++fields;
+        }
+        if (fields > 0) profile.m_entries.push_back(entry);
+    }
+    return profile;
+}
+
+TuningProfile TuningProfile::loadDefault() {
+    try {
+        return load(defaultPath());
+    } catch (const std::exception&) {
+        return TuningProfile();
+    }
+}
+
+void TuningProfile::save(const std::string& path) const {
+    std::ofstream file(path);
+    if (!file.is_open()) {
+        throw std::runtime_error("Cannot write file: " + path);
+    }
+    file << "# Profil de réglage : gameoflife_console --tune\n";
+    file << "# cells=2^<log2 cellules> density=<dixièmes> toroidal=0|1 -> stratégie la plus rapide\n";
+    for (const auto& entry : m_entries) {
+        file << "cells=2^" << entry.sizeClass
+             << " density=" << entry.densityClass / 10 << '.' << entry.densityClass % 10
+             << " toroidal=" << (entry.toroidal ? 1 : 0)
+             << " parallel=" << (entry.config.parallel ? 1 : 0)
+             << " threads=" << entry.config.threads
+             << " band=" << entry.config.bandRows
+             << " rate=" << entry.config.cellsPerSecond << "\n";
+    }
+    if (!file) {
+        throw std::runtime_error("Cannot write file: " + path);
+    }
+}
+
+int TuningProfile::sizeClass(int width, int height) {
+    double cells = static_cast<double>(width) * height;
+    return cells < 1.0 ? 0 : static_cast<int>(std::lround(std::log2(cells)));
+}
+
+int TuningProfile::densityClass(double density) {
+    return static_cast<int>(std::lround(std::clamp(density, 0.0, 1.0) * 10.0));
+}
+
+void TuningProfile::set(int width, int height, double density, bool toroidal, const TuningConfig& config) {
+    Entry entry;
+    entry.sizeClass = sizeClass(width, height);
+    entry.densityClass = densityClass(density);
+    entry.toroidal = toroidal;
+    entry.config = config;
+
+    for (auto& existing : m_entries) {
+        if (existing.sizeClass == entry.sizeClass && existing.densityClass == entry.densityClass &&
+            existing.toroidal == entry.toroidal) {
+            existing = entry;
+            return;
+        }
+    }
+    m_entries.push_back(entry);
+    std::sort(m_entries.begin(), m_entries.end(), [](const Entry& a, const Entry& b) {
+        if (a.toroidal != b.toroidal) return b.toroidal;
+        if (a.sizeClass != b.sizeClass) return a.sizeClass < b.sizeClass;
+        return a.densityClass < b.densityClass;
+    });
+}
+
+const TuningConfig* TuningProfile::find(int width, int height, double density, bool toroidal) const {
+    const int size = sizeClass(width, height);
+    const int dens = densityClass(density);
+    const Entry* best = nullptr;
+    bool hasSmaller = false;
+    bool hasLarger = false;
+    for (const auto& entry : m_entries) {
+        if (entry.toroidal != toroidal) continue;
+        hasSmaller = hasSmaller || entry.sizeClass < size;
+        hasLarger = hasLarger || entry.sizeClass > size;
+        if (best == nullptr) {
+            best = &entry;
+            continue;
+        }
+        int sizeDistance = std::abs(entry.sizeClass - size);
+        int bestSizeDistance = std::abs(best->sizeClass - size);
+        if (sizeDistance < bestSizeDistance ||
+            (sizeDistance == bestSizeDistance && std::abs(entry.densityClass - dens) < std::abs(best->densityClass - dens))) {
+            best = &entry;
+        }
+    }
+    if (best == nullptr) return nullptr;
+    
+    // Une mesure ne vaut que pour les tailles voisines ou encadrées par d'autres mesures :
+    // hors de la plage mesurée, la grille reste séquentielle
+    if (std::abs(best->sizeClass - size) > 1 && !(hasSmaller && hasLarger)) return nullptr;
+    return &best->config;
+}
+
+AutoTuner::AutoTuner(int width, int height, double density, bool toroidal, std::uint64_t seed)
+    : m_width(width)
+    , m_height(height)
+    , m_density(density)
+    , m_toroidal(toroidal)
+    , m_seed(seed)
+{
+    if (width <= 0 || height <= 0) {
+        throw std::invalid_argument("Tuning grid size must be positive");
+    }
+    if (density < 0.0 || density > 1.0) {
+        throw std::invalid_argument("Tuning density must be between 0 and 1");
+    }
+}
+
+std::vector<TuningConfig> AutoTuner::candidates(unsigned int maxThreads) const {
+    if (maxThreads == 0) maxThreads = std::thread::hardware_concurrency();
+    if (maxThreads < 2) maxThreads = 2;
+
+    // 2, 4, 8... jusqu'au nombre de cœurs, qui est toujours essayé
+    std::vector<unsigned int> threadCounts;
+    for (unsigned int threads = 2; threads < maxThreads; threads *= 2) {
+        threadCounts.push_back(threads);
+    }
+    threadCounts.push_back(maxThreads);
+
+    std::vector<TuningConfig> configs;
+    configs.push_back(TuningConfig());
+    for (unsigned int threads : threadCounts) {
+        if (static_cast<int>(threads) > m_height) break;
+        TuningConfig config;
+        config.parallel = true;
+        config.threads = threads;
+        configs.push_back(config);
+
+        // Bandes plus petites que la part de chaque thread : répartition dynamique
+        for (int bandRows : {8, 32}) {
+            if (bandRows * static_cast<int>(threads) * 2 > m_height) continue;
+            config.bandRows = bandRows;
+            configs.push_back(config);
+        }
+    }
+    return configs;
+}
+
+std::vector<TuningConfig> AutoTuner::run(double secondsPerCandidate, const ProgressCallback& onMeasured,
+                                         unsigned int maxThreads) const {
+    SoupOptions options;
+    options.width = m_width;
+    options.height = m_height;
+    options.density = m_density;
+    options.seed = m_seed;
+    std::vector<std::uint8_t> codes;
+    SoupRunner(options).generateSoup(0, codes);
+    const Grid soup(m_width, m_height, codes, m_toroidal);
+    const ClassicRule rule;
+    const double cells = static_cast<double>(m_width) * m_height;
+
+    // Candidats mesurés à tour de rôle sur plusieurs passes, meilleur débit conservé :
+    // une perturbation passagère de la machine ne pénalise pas un seul candidat
+    const int rounds = 3;
+    std::vector<TuningConfig> measured = candidates(maxThreads);
+    for (int round = 0; round < rounds; ++round) {
+        for (auto& config : measured) {
+            // Chaque mesure repart de la même soupe, après une génération de chauffe
+            Grid grid(soup);
+            grid.update(rule, config.parallel, config.threads, config.bandRows);
+
+            int generations = 0;
+            auto start = std::chrono::steady_clock::now();
+            double elapsed = 0.0;
+            while (generations < 2 || elapsed < secondsPerCandidate / rounds) {
+                grid.update(rule, config.parallel, config.threads, config.bandRows);
+                ++generations;
+                elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            }
+            config.cellsPerSecond = std::max(config.cellsPerSecond, cells * generations / elapsed);
+            if (round == rounds - 1 && onMeasured) onMeasured(config);
+        }
+    }
+    return measured;
+}
+
+TuningConfig AutoTuner::best(const std::vector<TuningConfig>& measured) {
+    TuningConfig best;
+    for (const auto& config : measured) {
+        if (!config.parallel && config.cellsPerSecond > best.cellsPerSecond) best = config;
+    }
+    const double sequential = best.cellsPerSecond;
+    for (const auto& config : measured) {
+        if (config.parallel && config.cellsPerSecond > best.cellsPerSecond &&
+            config.cellsPerSecond > sequential * 1.05) {
+            best = config;
+        }
+    }
+    return best;
+}
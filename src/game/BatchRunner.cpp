@@ -0,0 +1,193 @@
+#include "game/BatchRunner.hpp"
+#include "game/Game.hpp"
+#include "rules/ClassicRule.hpp"
+#include "io/FileHandler.hpp"
+#include "util/ThreadPool.hpp"
+#include <filesystem>
+#include <fstream>
+#include <algorithm>
+#include <numeric>
+#include <map>
+#include <mutex>
+#include <chrono>
+#include <iomanip>
+#include <stdexcept>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+/**
+ * @brief Échappe un champ CSV si nécessaire
+ */
+std::string csvField(const std::string& value) {
+    if (value.find_first_of(",\"\n") == std::string::npos) return value;
+    std::string quoted = "\"";
+    for (char c : value) {
+        if (c == '"') quoted += '"';
+        quoted += c;
+    }
+    return quoted + "\"";
+}
+
+} // namespace
+
+BatchRunner::BatchRunner(const BatchOptions& options)
+    : m_options(options)
+{
+}
+
+std::vector<std::string> BatchRunner::collectInputs(const std::string& source) {
+    std::vector<std::string> inputs;
+    std::error_code ec;
+
+    if (fs::is_directory(source, ec)) {
+        for (const auto& entry : fs::directory_iterator(source)) {
+            if (!entry.is_regular_file()) continue;
+            std::string ext = FileHandler::getExtension(entry.path().string());
+            if (ext == ".txt" || ext == ".mc") {
+                inputs.push_back(entry.path().string());
+            }
+        }
+        std::sort(inputs.begin(), inputs.end());
+        return inputs;
+    }
+
+    std::ifstream manifest(source);
+    if (!manifest.is_open()) {
+        throw std::runtime_error("Cannot open file: " + source);
+    }
+
+    fs::path baseDir = fs::path(source).parent_path();
+    std::string line;
+    while (std::getline(manifest, line)) {
+        size_t begin = line.find_first_not_of(" \t\r");
+        if (begin == std::string::npos || line[begin] == '#') continue;
+        size_t end = line.find_last_not_of(" \t\r");
+        fs::path path(line.substr(begin, end - begin + 1));
+        inputs.push_back(path.is_relative() ? (baseDir / path).string() : path.string());
+    }
+    return inputs;
+}
+
+BatchResult BatchRunner::runOne(const std::string& inputFile, const std::string& outputDir) const {
+    BatchResult result;
+    result.inputFile = inputFile;
+    auto start = std::chrono::steady_clock::now();
+
+    try {
+        auto grid = FileHandler::loadFromFile(inputFile, m_options.toroidal);
+        result.width = grid->getWidth();
+        result.height = grid->getHeight();
+
+        // Chaque fichier est simulé séquentiellement : le parallélisme est entre les fichiers
+        Game game(std::move(grid), std::make_unique<ClassicRule>(), m_options.iterations);
+        game.setCycleDetection(m_options.maxPeriod);
+
+        auto saveIteration = [&](int iter) {
+            FileHandler::saveToFile(game.getGrid(),
+                                    FileHandler::getIterationFilename(outputDir, iter, m_options.outputExtension));
+        };
+
+        if (!outputDir.empty()) {
+            fs::create_directories(outputDir);
+            result.outputDir = outputDir;
+            saveIteration(0);
+        }
+
+        while (game.step()) {
+            if (!outputDir.empty()) {
+                saveIteration(game.getIteration());
+            }
+        }
+
+        result.finalGeneration = game.getIteration();
+        result.population = game.countAliveCells();
+        result.period = game.getPeriod();
+        if (result.period == 0 && result.finalGeneration > 0 && game.isStable()) {
+            result.period = 1;
+        }
+        result.success = true;
+    } catch (const std::exception& e) {
+        result.error = e.what();
+    }
+
+    result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return result;
+}
+
+std::vector<BatchResult> BatchRunner::run(const std::vector<std::string>& inputs,
+                                          const ResultCallback& onResult) const {
+    const size_t count = inputs.size();
+    std::vector<BatchResult> results(count);
+    if (count == 0) return results;
+
+    // Dossiers de sortie, rendus uniques quand deux fichiers ont le même nom
+    std::vector<std::string> outputDirs(count);
+    if (m_options.writeOutputs) {
+        std::map<std::string, int> used;
+        for (size_t i = 0; i < count; ++i) {
+            std::string base = FileHandler::getBaseName(inputs[i]);
+            std::string name = base + "_out";
+            for (int suffix = 2; used.count(name); ++suffix) {
+                name = base + "_" + std::to_string(suffix) + "_out";
+            }
+            used[name] = 1;
+            outputDirs[i] = m_options.outputRoot.empty() ? name : (fs::path(m_options.outputRoot) / name).string();
+        }
+    }
+
+    // Les plus gros fichiers d'abord : les derniers fichiers traités sont courts
+    std::vector<size_t> order(count);
+    std::vector<std::uintmax_t> sizes(count, 0);
+    for (size_t i = 0; i < count; ++i) {
+        std::error_code ec;
+        std::uintmax_t size = fs::file_size(inputs[i], ec);
+        sizes[i] = ec ? 0 : size;
+    }
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&sizes](size_t a, size_t b) { return sizes[a] > sizes[b]; });
+
+    unsigned int threads = m_options.threadCount;
+    if (threads == 0) {
+        threads = std::thread::hardware_concurrency();
+        if (threads == 0) threads = 4;
+    }
+    ThreadPool pool(static_cast<unsigned int>(std::min<size_t>(threads, count)));
+
+    std::mutex callbackMutex;
+    size_t done = 0;
+    pool.parallelFor(count, [&](size_t index, unsigned int) {
+        size_t job = order[index];
+        results[job] = runOne(inputs[job], outputDirs[job]);
+        if (onResult) {
+            std::lock_guard<std::mutex> lock(callbackMutex);
+            onResult(results[job], ++done, count);
+        }
+    });
+
+    return results;
+}
+
+void BatchRunner::writeSummary(const std::vector<BatchResult>& results, std::ostream& out) {
+    out << "file,width,height,generations,population,state,period,seconds,error\n";
+    for (const auto& result : results) {
+        std::string state;
+        if (!result.success) {
+            state = "error";
+        } else if (result.period == 1) {
+            state = "stable";
+        } else if (result.period > 1) {
+            state = "oscillating";
+        } else {
+            state = "running";
+        }
+
+        out << csvField(result.inputFile) << ','
+            << result.width << ',' << result.height << ','
+            << result.finalGeneration << ',' << result.population << ','
+            << state << ',' << result.period << ','
+            << std::fixed << std::setprecision(4) << result.seconds << ','
+            << csvField(result.error) << '\n';
+    }
+}
@@ -1,4 +1,8 @@
 #include "game/Game.hpp"
+#include "game/AutoTuner.hpp"
+#include "util/Metrics.hpp"
+#include "util/Tracer.hpp"
+#include <chrono>
 
 Game::Game(std::unique_ptr<Grid> grid, std::unique_ptr<Rule> rule, int maxIterations)
     : m_grid(std::move(grid))
@@ -7,22 +11,69 @@ Game::Game(std::unique_ptr<Grid> grid, std::unique_ptr<Rule> rule, int maxIterat
     , m_maxIterations(maxIterations)
     , m_running(false)
     , m_parallel(false)
+    , m_threadCount(0)
+    , m_bandRows(0)
     , m_previousGrid(*m_grid)
+    , m_maxPeriod(0)
+    , m_period(0)
+    , m_lastStepNanoseconds(0)
 {
 }
 
+void Game::setCycleDetection(int maxPeriod) {
+    m_maxPeriod = maxPeriod > 0 ? maxPeriod : 0;
+    resetHistory();
+}
+
+void Game::resetHistory() {
+    m_period = 0;
+    m_history.clear();
+    if (m_maxPeriod > 0) {
+        m_history.push_back(m_grid->hash());
+    }
+}
+
 bool Game::step() {
-    if (isFinished()) {
-        return false;
+    TraceSpan span("Game::step", "simulation");
+    span.addArg("iteration", m_iteration + 1);
+    ScopedTimer stepTimer(Metrics::Phase::Step);
+    auto start = std::chrono::steady_clock::now();
+    {
+        ScopedTimer timer(Metrics::Phase::StabilityCheck);
+        if (isFinished()) {
+            return false;
+        }
     }
     
     // Sauvegarde l'état actuel pour détecter la stabilité
-    m_previousGrid = *m_grid;
+    {
+        ScopedTimer timer(Metrics::Phase::Snapshot);
+        m_previousGrid = *m_grid;
+    }
     
     // Met à jour la grille
-    m_grid->update(*m_rule, m_parallel);
+    m_grid->update(*m_rule, m_parallel, m_threadCount, m_bandRows);
     ++m_iteration;
     
+    ScopedTimer timer(Metrics::Phase::StabilityCheck);
+    
+    // Recherche de la génération la plus récente identique à la nouvelle
+    if (m_maxPeriod > 0) {
+        std::uint64_t hash = m_grid->hash();
+        for (size_t i = m_history.size(); i-- > 0;) {
+            if (m_history[i] == hash) {
+                m_period = static_cast<int>(m_history.size() - i);
+                break;
+            }
+        }
+        m_history.push_back(hash);
+        if (static_cast<int>(m_history.size()) > m_maxPeriod) {
+            m_history.pop_front();
+        }
+    }
+    
+    m_lastStepNanoseconds = static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - start).count());
     return !isFinished();
 }
 
@@ -37,6 +88,11 @@ bool Game::isFinished() const {
         return true;
     }
     
+    // Terminé si un cycle a été détecté
+    if (m_period > 0) {
+        return true;
+    }
+    
     return false;
 }
 
@@ -49,12 +105,41 @@ void Game::reset(std::unique_ptr<Grid> grid) {
     m_previousGrid = *m_grid;
     m_iteration = 0;
     m_running = false;
+    resetHistory();
+}
+
+void Game::restart() {
+    m_previousGrid = *m_grid;
+    m_iteration = 0;
+    m_running = false;
+    resetHistory();
+}
+
+void Game::restore(std::unique_ptr<Grid> grid, const Grid& previousGrid, int iteration) {
+    m_grid = std::move(grid);
+    m_previousGrid = previousGrid;
+    m_iteration = iteration;
+    m_running = false;
+    resetHistory();
 }
 
 void Game::setRule(std::unique_ptr<Rule> rule) {
     m_rule = std::move(rule);
 }
 
+bool Game::applyTuning(const TuningProfile& profile) {
+    double cells = static_cast<double>(m_grid->getWidth()) * m_grid->getHeight();
+    double density = cells > 0 ? countAliveCells() / cells : 0.0;
+    const TuningConfig* config = profile.find(m_grid->getWidth(), m_grid->getHeight(), density,
+                                              m_grid->isToroidal());
+    if (config == nullptr) return false;
+    
+    m_parallel = config->parallel;
+    m_threadCount = config->threads;
+    m_bandRows = config->bandRows;
+    return true;
+}
+
 int Game::countAliveCells() const {
     int count = 0;
     for (int y = 0; y < m_grid->getHeight(); ++y) {
@@ -67,3 +152,7 @@ int Game::countAliveCells() const {
     return count;
 }
 
+size_t Game::memoryBytes() const {
+    return m_grid->memoryBytes() + m_previousGrid.memoryBytes() + m_history.size() * sizeof(std::uint64_t);
+}
+
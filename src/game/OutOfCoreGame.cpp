@@ -0,0 +1,32 @@
+#include "game/OutOfCoreGame.hpp"
+
+OutOfCoreGame::OutOfCoreGame(std::unique_ptr<BandedGrid> grid, std::unique_ptr<Rule> rule, int maxIterations)
+    : m_grid(std::move(grid))
+    , m_rule(std::move(rule))
+    , m_iteration(0)
+    , m_maxIterations(maxIterations)
+    , m_stable(false)
+{
+}
+
+bool OutOfCoreGame::step() {
+    if (isFinished()) {
+        return false;
+    }
+
+    // La grille signale elle-même si une cellule a changé
+    m_stable = !m_grid->step(*m_rule);
+    ++m_iteration;
+
+    return !isFinished();
+}
+
+bool OutOfCoreGame::isFinished() const {
+    // Terminé si le nombre max d'itérations est atteint
+    if (m_maxIterations > 0 && m_iteration >= m_maxIterations) {
+        return true;
+    }
+
+    // Terminé si la grille est stable (plus d'évolution)
+    return m_iteration > 0 && m_stable;
+}
@@ -0,0 +1,215 @@
+#include "game/SimulationThread.hpp"
+#include "util/Tracer.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <exception>
+
+SimulationThread::SimulationThread(Game& game, int intervalMs)
+    : m_game(game)
+    , m_pending(0)
+    , m_stopping(false)
+    , m_intervalMs(intervalMs)
+    , m_turbo(false)
+    , m_turboRate(0)
+    , m_publishIntervalMs(16)
+    , m_generationsPerSecond(0.0)
+    , m_sequence(0)
+    , m_lastWidth(0)
+    , m_lastBase(0)
+{
+    // Première génération disponible dès le retour du constructeur
+    publish();
+    m_frames.fetch();
+    m_thread = std::thread(&SimulationThread::run, this);
+}
+
+SimulationThread::~SimulationThread() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_wakeUp.notify_one();
+    m_thread.join();
+}
+
+void SimulationThread::run() {
+    if (Tracer::isEnabled()) Tracer::setThreadName("simulation");
+
+    using Clock = std::chrono::steady_clock;
+    auto nextStep = Clock::now();
+    auto lastPublish = nextStep;
+    auto rateStart = nextStep;
+    int rateSteps = 0;
+    std::unique_lock<std::mutex> lock(m_mutex);
+    for (;;) {
+        // Attend une commande, l'arrêt ou l'heure de la prochaine génération
+        auto hasWork = [this]() { return m_stopping || !m_commands.empty(); };
+        if (m_game.isRunning() && !m_game.isFinished()) {
+            m_wakeUp.wait_until(lock, nextStep, hasWork);
+        } else {
+            m_wakeUp.wait(lock, hasWork);
+        }
+
+        if (!m_commands.empty()) {
+            std::deque<Command> commands;
+            commands.swap(m_commands);
+            lock.unlock();
+
+            std::string error;
+            for (auto& command : commands) {
+                try {
+                    command(m_game);
+                } catch (const std::exception& e) {
+                    error = e.what();
+                }
+            }
+            publish();
+
+            lock.lock();
+            if (!error.empty()) m_error = error;
+            m_pending -= commands.size();
+            if (m_pending == 0) m_idle.notify_all();
+            continue;
+        }
+        if (m_stopping) return;
+
+        auto now = Clock::now();
+        if (!m_game.isRunning() || m_game.isFinished()) {
+            m_generationsPerSecond = 0.0;
+            rateSteps = 0;
+            rateStart = now;
+            continue;
+        }
+        if (now < nextStep) continue;
+
+        lock.unlock();
+        m_game.step();
+
+        // Débit mesuré sur environ une demi-seconde
+        ++rateSteps;
+        now = Clock::now();
+        double elapsed = std::chrono::duration<double>(now - rateStart).count();
+        if (elapsed >= 0.5) {
+            m_generationsPerSecond = rateSteps / elapsed;
+            rateSteps = 0;
+            rateStart = now;
+        }
+
+        // En turbo, seule la dernière génération de chaque intervalle d'affichage est publiée
+        const bool turbo = isTurbo();
+        if (!turbo || !m_game.isRunning() || m_game.isFinished() ||
+            now - lastPublish >= std::chrono::milliseconds(m_publishIntervalMs.load(std::memory_order_relaxed))) {
+            publish();
+            lastPublish = now;
+        }
+
+        std::chrono::microseconds interval(static_cast<long long>(getInterval()) * 1000);
+        if (turbo) {
+            const int rate = getTurboRate();
+            interval = std::chrono::microseconds(rate > 0 ? 1000000 / rate : 0);
+        }
+        // Un retard d'au plus un intervalle est rattrapé, au-delà il est abandonné
+        nextStep = std::max(nextStep + interval, now - interval);
+        lock.lock();
+    }
+}
+
+void SimulationThread::publish() {
+    TraceSpan span("SimulationThread::publish", "simulation");
+    const Grid& grid = m_game.getGrid();
+    SimulationFrame& frame = m_frames.back();
+    frame.width = grid.getWidth();
+    frame.height = grid.getHeight();
+    frame.toroidal = grid.isToroidal();
+    frame.parallel = m_game.isParallel();
+    frame.running = m_game.isRunning() && !m_game.isFinished();
+    frame.stable = m_game.getIteration() > 0 && m_game.isStable();
+    frame.iteration = m_game.getIteration();
+    frame.generationsPerSecond = m_generationsPerSecond;
+    frame.turbo = isTurbo();
+    frame.stepMilliseconds = m_game.getLastStepNanoseconds() / 1e6;
+    frame.memoryBytes = m_game.memoryBytes();
+
+    grid.toCodes(frame.codes);
+    int population = 0;
+    for (std::uint8_t code : frame.codes) {
+        population += code & 1;
+    }
+    frame.population = population;
+
+    markDirtyTiles(frame);
+    frame.sequence = ++m_sequence;
+    m_frames.publish();
+}
+
+void SimulationThread::markDirtyTiles(SimulationFrame& frame) {
+    const int tile = SimulationFrame::TILE_SIZE;
+    const int tilesX = (frame.width + tile - 1) / tile;
+    const int tilesY = (frame.height + tile - 1) / tile;
+
+    const bool sameSize = m_lastCodes.size() == frame.codes.size() && m_lastWidth == frame.width;
+    if (m_frames.pending()) {
+        // La publication précédente sera abandonnée : ses tuiles restent à redessiner
+        // (si l'interface la récupère entre-temps, la référence ne correspond plus et
+        // elle redessine toute la grille)
+        frame.baseSequence = m_lastBase;
+        frame.dirtyTiles = m_lastDirty;
+    } else {
+        frame.baseSequence = m_sequence;
+        frame.dirtyTiles.assign(static_cast<size_t>(tilesX) * tilesY, 0);
+    }
+
+    if (!sameSize) {
+        frame.dirtyTiles.assign(static_cast<size_t>(tilesX) * tilesY, 1);
+    } else {
+        for (int y = 0; y < frame.height; ++y) {
+            const size_t row = static_cast<size_t>(y) * frame.width;
+            std::uint8_t* dirty = frame.dirtyTiles.data() + static_cast<size_t>(y / tile) * tilesX;
+            for (int tx = 0; tx < tilesX; ++tx) {
+                if (dirty[tx]) continue;
+                const size_t start = row + static_cast<size_t>(tx) * tile;
+                const size_t length = static_cast<size_t>(std::min(tile, frame.width - tx * tile));
+                if (std::memcmp(&frame.codes[start], &m_lastCodes[start], length) != 0) {
+                    dirty[tx] = 1;
+                }
+            }
+        }
+    }
+    frame.tilesX = tilesX;
+    frame.tilesY = tilesY;
+    m_lastCodes = frame.codes;
+    m_lastWidth = frame.width;
+    m_lastBase = frame.baseSequence;
+    m_lastDirty = frame.dirtyTiles;
+}
+
+void SimulationThread::submit(Command command) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_commands.push_back(std::move(command));
+        ++m_pending;
+    }
+    m_wakeUp.notify_one();
+}
+
+void SimulationThread::flush() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_idle.wait(lock, [this]() { return m_pending == 0; });
+}
+
+bool SimulationThread::isIdle() const {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_pending > 0) return false;
+    }
+    // Les commandes terminées ont déjà publié : la vérification suit celle de la file
+    return !m_frames.pending();
+}
+
+std::string SimulationThread::takeError() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::string error;
+    error.swap(m_error);
+    return error;
+}
@@ -0,0 +1,123 @@
+#include "game/SoupRunner.hpp"
+#include "game/Game.hpp"
+#include "rules/ClassicRule.hpp"
+#include "util/CounterRng.hpp"
+#include "util/ThreadPool.hpp"
+#include <memory>
+#include <mutex>
+#include <algorithm>
+#include <stdexcept>
+
+void SoupStatistics::add(const SoupResult& result) {
+    ++soups;
+    finalPopulationSum += result.finalPopulation;
+    ++periodCounts[result.period];
+    if (result.period > 0) {
+        ++settled;
+        lifespanSum += result.lifespan;
+    }
+    if (result.lifespan > maxLifespan ||
+        (result.lifespan == maxLifespan && result.index < maxLifespanSoup)) {
+        maxLifespan = result.lifespan;
+        maxLifespanSoup = result.index;
+    }
+}
+
+void SoupStatistics::merge(const SoupStatistics& other) {
+    soups += other.soups;
+    settled += other.settled;
+    lifespanSum += other.lifespanSum;
+    finalPopulationSum += other.finalPopulationSum;
+    for (const auto& entry : other.periodCounts) {
+        periodCounts[entry.first] += entry.second;
+    }
+    // À égalité, la soupe de plus petit numéro : le résultat ne dépend pas de la répartition
+    if (other.maxLifespan > maxLifespan ||
+        (other.maxLifespan == maxLifespan && other.maxLifespanSoup < maxLifespanSoup)) {
+        maxLifespan = other.maxLifespan;
+        maxLifespanSoup = other.maxLifespanSoup;
+    }
+}
+
+SoupRunner::SoupRunner(const SoupOptions& options)
+    : m_options(options)
+{
+    if (options.width <= 0 || options.height <= 0) {
+        throw std::invalid_argument("Soup dimensions must be positive");
+    }
+    if (options.density < 0.0 || options.density > 1.0) {
+        throw std::invalid_argument("Soup density must be between 0 and 1");
+    }
+}
+
+void SoupRunner::generateSoup(long long index, std::vector<std::uint8_t>& codes) const {
+    codes.resize(static_cast<size_t>(m_options.width) * m_options.height);
+
+    // Seuil entier : une cellule est vivante si le tirage 32 bits est inférieur au seuil
+    const std::uint64_t threshold = static_cast<std::uint64_t>(m_options.density * 4294967296.0);
+    CounterRng rng(m_options.seed, static_cast<std::uint64_t>(index));
+    for (auto& code : codes) {
+        code = (rng.next() < threshold) ? 1 : 0;
+    }
+}
+
+SoupStatistics SoupRunner::run(const ResultCallback& onResult) const {
+    unsigned int threads = m_options.threadCount;
+    if (threads == 0) {
+        threads = std::thread::hardware_concurrency();
+        if (threads == 0) threads = 4;
+    }
+    if (m_options.count <= 0) return SoupStatistics();
+    threads = static_cast<unsigned int>(std::min<long long>(threads, m_options.count));
+
+    // Tampons par thread, réutilisés pour toutes les soupes simulées par ce thread
+    struct Worker {
+        std::unique_ptr<Game> game;
+        std::vector<std::uint8_t> codes;
+        SoupStatistics statistics;
+    };
+    std::vector<Worker> workers(threads);
+    for (auto& worker : workers) {
+        auto grid = std::make_unique<Grid>(m_options.width, m_options.height, m_options.toroidal);
+        worker.game = std::make_unique<Game>(std::move(grid), std::make_unique<ClassicRule>(),
+                                             m_options.maxGenerations);
+        worker.game->setCycleDetection(m_options.maxPeriod);
+    }
+
+    std::mutex callbackMutex;
+    ThreadPool pool(threads);
+    pool.parallelFor(static_cast<size_t>(m_options.count), [&](size_t index, unsigned int workerIndex) {
+        Worker& worker = workers[workerIndex];
+        Game& game = *worker.game;
+
+        generateSoup(static_cast<long long>(index), worker.codes);
+        game.getGrid().fromCodes(worker.codes);
+        game.restart();
+
+        SoupResult result;
+        result.index = static_cast<long long>(index);
+        result.initialPopulation = static_cast<int>(std::count(worker.codes.begin(), worker.codes.end(), 1));
+        while (game.step()) {
+        }
+
+        result.finalGeneration = game.getIteration();
+        result.finalPopulation = game.countAliveCells();
+        result.period = game.getPeriod();
+        if (result.period == 0 && result.finalGeneration > 0 && game.isStable()) {
+            result.period = 1;
+        }
+        result.lifespan = (result.period > 0) ? result.finalGeneration - result.period : result.finalGeneration;
+        worker.statistics.add(result);
+
+        if (onResult) {
+            std::lock_guard<std::mutex> lock(callbackMutex);
+            onResult(result);
+        }
+    });
+
+    SoupStatistics total;
+    for (const auto& worker : workers) {
+        total.merge(worker.statistics);
+    }
+    return total;
+}
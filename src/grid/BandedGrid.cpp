@@ -0,0 +1,317 @@
+#include "grid/BandedGrid.hpp"
+#include <filesystem>
+#include <future>
+#include <stdexcept>
+#include <algorithm>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+inline int popcount64(std::uint64_t value) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_popcountll(value);
+#else
+    int count = 0;
+    while (value) {
+        value &= value - 1;
+        ++count;
+    }
+    return count;
+#endif
+}
+
+/**
+ * @brief Ajoute un plan de bits à un compteur bit-parallèle sur 4 bits (0 à 8)
+ */
+inline void addBits(std::uint64_t bits, std::uint64_t& s0, std::uint64_t& s1, std::uint64_t& s2, std::uint64_t& s3) {
+    std::uint64_t c0 = s0 & bits;
+    s0 ^= bits;
+    std::uint64_t c1 = s1 & c0;
+    s1 ^= c0;
+    std::uint64_t c2 = s2 & c1;
+    s2 ^= c1;
+    s3 |= c2;
+}
+
+/**
+ * @brief Masque des cellules dont le compteur vaut exactement n
+ */
+inline std::uint64_t countEquals(int n, std::uint64_t s0, std::uint64_t s1, std::uint64_t s2, std::uint64_t s3) {
+    return ((n & 1) ? s0 : ~s0) & ((n & 2) ? s1 : ~s1) & ((n & 4) ? s2 : ~s2) & ((n & 8) ? s3 : ~s3);
+}
+
+std::string storagePath(const std::string& basePath, int index) {
+    return basePath + ".band" + std::to_string(index);
+}
+
+} // namespace
+
+BandedGrid::BandedGrid(const std::string& basePath, int width, int height, bool toroidal, int bandRows)
+    : m_basePath(basePath)
+    , m_width(width)
+    , m_height(height)
+    , m_toroidal(toroidal)
+    , m_bandRows(bandRows)
+    , m_bandCount(0)
+    , m_wordsPerRow(0)
+    , m_current(0)
+    , m_population(0)
+    , m_lastStepChanged(true)
+{
+    if (width <= 0 || height <= 0) {
+        throw std::invalid_argument("Grid dimensions must be positive");
+    }
+    if (bandRows <= 0) {
+        throw std::invalid_argument("Band size must be positive");
+    }
+
+    m_bandRows = std::min(bandRows, height);
+    m_bandCount = (height + m_bandRows - 1) / m_bandRows;
+    m_wordsPerRow = (static_cast<size_t>(width) + 63) / 64;
+
+    // Fichiers creux : le système fournit des zéros (cellules mortes) sans les écrire
+    const std::uintmax_t fileSize = static_cast<std::uintmax_t>(height) * m_wordsPerRow * 2 * sizeof(std::uint64_t);
+    for (int i = 0; i < 2; ++i) {
+        std::string path = storagePath(m_basePath, i);
+        { std::ofstream create(path, std::ios::binary | std::ios::trunc); }
+        fs::resize_file(path, fileSize);
+        m_files[i].open(path, std::ios::binary | std::ios::in | std::ios::out);
+        if (!m_files[i].is_open()) {
+            throw std::runtime_error("Cannot create file: " + path);
+        }
+    }
+}
+
+BandedGrid::~BandedGrid() {
+    for (int i = 0; i < 2; ++i) {
+        m_files[i].close();
+        std::error_code ec;
+        fs::remove(storagePath(m_basePath, i), ec);
+    }
+}
+
+int BandedGrid::rowsInBand(int band) const {
+    return std::min(m_bandRows, m_height - band * m_bandRows);
+}
+
+std::vector<std::uint64_t> BandedGrid::readBand(int file, int band) const {
+    const size_t rowWords = m_wordsPerRow * 2;
+    std::vector<std::uint64_t> data(rowWords * rowsInBand(band));
+    std::fstream& stream = m_files[file];
+    stream.seekg(static_cast<std::streamoff>(static_cast<std::uint64_t>(band) * m_bandRows * rowWords * sizeof(std::uint64_t)));
+    stream.read(reinterpret_cast<char*>(data.data()), static_cast<std::streamsize>(data.size() * sizeof(std::uint64_t)));
+    if (!stream) {
+        throw std::runtime_error("Cannot read band storage: " + storagePath(m_basePath, file));
+    }
+    return data;
+}
+
+void BandedGrid::writeBand(int file, int band, const std::vector<std::uint64_t>& data) {
+    const size_t rowWords = m_wordsPerRow * 2;
+    std::fstream& stream = m_files[file];
+    stream.seekp(static_cast<std::streamoff>(static_cast<std::uint64_t>(band) * m_bandRows * rowWords * sizeof(std::uint64_t)));
+    stream.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size() * sizeof(std::uint64_t)));
+    if (!stream) {
+        throw std::runtime_error("Cannot write band storage: " + storagePath(m_basePath, file));
+    }
+}
+
+std::vector<std::uint64_t> BandedGrid::readRow(int file, int y) const {
+    const size_t rowWords = m_wordsPerRow * 2;
+    std::vector<std::uint64_t> data(rowWords);
+    std::fstream& stream = m_files[file];
+    stream.seekg(static_cast<std::streamoff>(static_cast<std::uint64_t>(y) * rowWords * sizeof(std::uint64_t)));
+    stream.read(reinterpret_cast<char*>(data.data()), static_cast<std::streamsize>(rowWords * sizeof(std::uint64_t)));
+    if (!stream) {
+        throw std::runtime_error("Cannot read band storage: " + storagePath(m_basePath, file));
+    }
+    return data;
+}
+
+void BandedGrid::importRows(const RowFiller& filler) {
+    const size_t rowWords = m_wordsPerRow * 2;
+    std::vector<std::uint8_t> codes(m_width);
+    m_population = 0;
+
+    for (int band = 0; band < m_bandCount; ++band) {
+        std::vector<std::uint64_t> data(rowWords * rowsInBand(band), 0);
+        for (int r = 0; r < rowsInBand(band); ++r) {
+            std::fill(codes.begin(), codes.end(), 0);
+            filler(band * m_bandRows + r, codes.data());
+
+            std::uint64_t* alive = data.data() + r * rowWords;
+            std::uint64_t* obstacle = alive + m_wordsPerRow;
+            for (int x = 0; x < m_width; ++x) {
+                std::uint64_t bit = std::uint64_t(1) << (x & 63);
+                if (codes[x] & 1) {
+                    alive[x >> 6] |= bit;
+                    ++m_population;
+                }
+                if (codes[x] & 2) obstacle[x >> 6] |= bit;
+            }
+        }
+        writeBand(m_current, band, data);
+    }
+    m_files[m_current].flush();
+    m_lastStepChanged = true;
+}
+
+void BandedGrid::exportRows(const RowSink& sink) const {
+    const size_t rowWords = m_wordsPerRow * 2;
+    std::vector<std::uint8_t> codes(m_width);
+
+    for (int band = 0; band < m_bandCount; ++band) {
+        std::vector<std::uint64_t> data = readBand(m_current, band);
+        for (int r = 0; r < rowsInBand(band); ++r) {
+            const std::uint64_t* alive = data.data() + r * rowWords;
+            const std::uint64_t* obstacle = alive + m_wordsPerRow;
+            for (int x = 0; x < m_width; ++x) {
+                int shift = x & 63;
+                codes[x] = static_cast<std::uint8_t>(((alive[x >> 6] >> shift) & 1) |
+                                                     (((obstacle[x >> 6] >> shift) & 1) << 1));
+            }
+            sink(band * m_bandRows + r, codes.data());
+        }
+    }
+}
+
+bool BandedGrid::computeRow(const std::uint64_t* above, const std::uint64_t* row, const std::uint64_t* below,
+                            std::uint64_t* out, const bool birth[9], const bool survive[9],
+                            long long& population) const {
+    const size_t n = m_wordsPerRow;
+    const int lastBit = (m_width - 1) & 63;
+    const std::uint64_t lastMask = (lastBit == 63) ? ~std::uint64_t(0) : ((std::uint64_t(1) << (lastBit + 1)) - 1);
+    const std::uint64_t* obstacle = row + n;
+    std::uint64_t* outObstacle = out + n;
+    std::uint64_t changed = 0;
+
+    // Voisin ouest (x - 1) et est (x + 1) d'un plan de bits, avec repli torique
+    auto west = [&](const std::uint64_t* r, size_t i) {
+        std::uint64_t carry = (i > 0) ? (r[i - 1] >> 63)
+                                      : (m_toroidal ? (r[n - 1] >> lastBit) & 1 : 0);
+        return (r[i] << 1) | carry;
+    };
+    auto east = [&](const std::uint64_t* r, size_t i) {
+        std::uint64_t value = (r[i] >> 1) | ((i + 1 < n) ? (r[i + 1] << 63) : 0);
+        if (i + 1 == n) {
+            value &= ~(std::uint64_t(1) << lastBit);
+            if (m_toroidal) value |= (r[0] & 1) << lastBit;
+        }
+        return value;
+    };
+
+    for (size_t i = 0; i < n; ++i) {
+        std::uint64_t s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+        addBits(west(above, i), s0, s1, s2, s3);
+        addBits(above[i], s0, s1, s2, s3);
+        addBits(east(above, i), s0, s1, s2, s3);
+        addBits(west(row, i), s0, s1, s2, s3);
+        addBits(east(row, i), s0, s1, s2, s3);
+        addBits(west(below, i), s0, s1, s2, s3);
+        addBits(below[i], s0, s1, s2, s3);
+        addBits(east(below, i), s0, s1, s2, s3);
+
+        std::uint64_t birthMask = 0;
+        std::uint64_t surviveMask = 0;
+        for (int count = 0; count <= 8; ++count) {
+            if (birth[count]) birthMask |= countEquals(count, s0, s1, s2, s3);
+            if (survive[count]) surviveMask |= countEquals(count, s0, s1, s2, s3);
+        }
+
+        // Les obstacles ne changent pas d'état
+        std::uint64_t alive = row[i];
+        std::uint64_t next = (obstacle[i] & alive) |
+                             (~obstacle[i] & ((alive & surviveMask) | (~alive & birthMask)));
+        if (i + 1 == n) next &= lastMask;
+
+        out[i] = next;
+        outObstacle[i] = obstacle[i];
+        changed |= next ^ alive;
+        population += popcount64(next);
+    }
+    return changed != 0;
+}
+
+bool BandedGrid::step(const Rule& rule) {
+    // Table de transition déduite de la règle (indépendante du nombre de cellules)
+    bool birth[9];
+    bool survive[9];
+    for (int count = 0; count <= 8; ++count) {
+        birth[count] = rule.computeNextState(false, count)->isAlive();
+        survive[count] = rule.computeNextState(true, count)->isAlive();
+    }
+
+    const size_t rowWords = m_wordsPerRow * 2;
+    const int source = m_current;
+    const int target = 1 - m_current;
+    const std::vector<std::uint64_t> deadRow(rowWords, 0);
+
+    // Lignes de bord pour le repli torique vertical
+    std::vector<std::uint64_t> firstRow, lastRow;
+    if (m_toroidal) {
+        firstRow = readRow(source, 0);
+        lastRow = readRow(source, m_height - 1);
+    }
+
+    // Fenêtre glissante : bande précédente, courante et suivante
+    std::vector<std::uint64_t> previous;
+    std::vector<std::uint64_t> current = readBand(source, 0);
+    std::vector<std::uint64_t> next;
+    std::future<std::vector<std::uint64_t>> prefetch;
+    if (m_bandCount > 1) {
+        prefetch = std::async(std::launch::async, &BandedGrid::readBand, this, source, 1);
+    }
+
+    std::vector<std::uint64_t> result;
+    std::future<void> pendingWrite;
+    long long population = 0;
+    bool changed = false;
+
+    for (int band = 0; band < m_bandCount; ++band) {
+        if (band + 1 < m_bandCount) {
+            next = prefetch.get();
+        } else {
+            next.clear();
+        }
+        if (band + 2 < m_bandCount) {
+            // Lecture de la bande d'après pendant le calcul de la bande courante
+            prefetch = std::async(std::launch::async, &BandedGrid::readBand, this, source, band + 2);
+        }
+
+        const int rows = rowsInBand(band);
+        std::vector<std::uint64_t> output(rowWords * rows);
+        for (int r = 0; r < rows; ++r) {
+            const std::uint64_t* above;
+            if (r > 0) above = current.data() + (r - 1) * rowWords;
+            else if (band > 0) above = previous.data() + (m_bandRows - 1) * rowWords;
+            else above = m_toroidal ? lastRow.data() : deadRow.data();
+
+            const std::uint64_t* below;
+            if (r + 1 < rows) below = current.data() + (r + 1) * rowWords;
+            else if (band + 1 < m_bandCount) below = next.data();
+            else below = m_toroidal ? firstRow.data() : deadRow.data();
+
+            if (computeRow(above, current.data() + r * rowWords, below, output.data() + r * rowWords,
+                           birth, survive, population)) {
+                changed = true;
+            }
+        }
+
+        // Écriture en arrière-plan (une seule écriture en cours à la fois)
+        if (pendingWrite.valid()) pendingWrite.get();
+        result = std::move(output);
+        pendingWrite = std::async(std::launch::async, &BandedGrid::writeBand, this, target, band, std::cref(result));
+
+        previous = std::move(current);
+        current = std::move(next);
+    }
+
+    if (pendingWrite.valid()) pendingWrite.get();
+    m_files[target].flush();
+
+    m_current = target;
+    m_population = population;
+    m_lastStepChanged = changed;
+    return changed;
+}
@@ -0,0 +1,97 @@
+#include "grid/DensityPyramid.hpp"
+#include <algorithm>
+
+DensityPyramid::DensityPyramid()
+    : m_width(0)
+    , m_height(0)
+{
+}
+
+void DensityPyramid::rebuild(const std::uint8_t* codes, int width, int height) {
+    m_width = width;
+    m_height = height;
+
+    // Niveaux jusqu'à un bloc couvrant toute la grille
+    int levelCount = 0;
+    while ((1 << levelCount) < std::max(width, height)) ++levelCount;
+    m_levels.assign(static_cast<size_t>(std::max(levelCount, 1)), {});
+    for (int level = 1; level <= getLevelCount(); ++level) {
+        m_levels[level - 1].assign(static_cast<size_t>(getLevelWidth(level)) * getLevelHeight(level), 0);
+    }
+
+    if (width > 0 && height > 0) {
+        update(codes, 0, 0, width, height);
+    }
+}
+
+void DensityPyramid::update(const std::uint8_t* codes, int x, int y, int width, int height) {
+    if (width <= 0 || height <= 0 || m_levels.empty()) return;
+
+    // Blocs touchés par la région, puis leurs parents niveau par niveau
+    int x0 = x >> 1;
+    int y0 = y >> 1;
+    int x1 = (x + width - 1) >> 1;
+    int y1 = (y + height - 1) >> 1;
+    computeFirstLevel(codes, x0, y0, x1, y1);
+
+    for (int level = 2; level <= getLevelCount(); ++level) {
+        x0 >>= 1;
+        y0 >>= 1;
+        x1 >>= 1;
+        y1 >>= 1;
+        computeLevel(level, x0, y0, x1, y1);
+    }
+}
+
+void DensityPyramid::computeFirstLevel(const std::uint8_t* codes, int x0, int y0, int x1, int y1) {
+    // Densité d'un bloc 2x2 selon son nombre de cellules vivantes
+    static const std::uint8_t density[5] = {0, 64, 128, 191, 255};
+
+    std::uint8_t* out = m_levels[0].data();
+    const int levelWidth = getLevelWidth(1);
+    for (int by = y0; by <= y1; ++by) {
+        const int cy = by * 2;
+        const std::uint8_t* top = codes + static_cast<size_t>(cy) * m_width;
+        const std::uint8_t* bottom = (cy + 1 < m_height) ? top + m_width : nullptr;
+        for (int bx = x0; bx <= x1; ++bx) {
+            const int cx = bx * 2;
+            const bool hasRight = cx + 1 < m_width;
+            int alive = (top[cx] & 1) + (hasRight ? (top[cx + 1] & 1) : 0);
+            if (bottom) {
+                alive += (bottom[cx] & 1) + (hasRight ? (bottom[cx + 1] & 1) : 0);
+            }
+            out[static_cast<size_t>(by) * levelWidth + bx] = density[alive];
+        }
+    }
+}
+
+void DensityPyramid::computeLevel(int level, int x0, int y0, int x1, int y1) {
+    const std::uint8_t* below = m_levels[level - 2].data();
+    const int belowWidth = getLevelWidth(level - 1);
+    const int belowHeight = getLevelHeight(level - 1);
+    std::uint8_t* out = m_levels[level - 1].data();
+    const int levelWidth = getLevelWidth(level);
+
+    for (int by = y0; by <= y1; ++by) {
+        const int cy = by * 2;
+        const std::uint8_t* top = below + static_cast<size_t>(cy) * belowWidth;
+        const std::uint8_t* bottom = (cy + 1 < belowHeight) ? top + belowWidth : nullptr;
+        for (int bx = x0; bx <= x1; ++bx) {
+            const int cx = bx * 2;
+            const bool hasRight = cx + 1 < belowWidth;
+            int sum = top[cx] + (hasRight ? top[cx + 1] : 0);
+            if (bottom) {
+                sum += bottom[cx] + (hasRight ? bottom[cx + 1] : 0);
+            }
+            out[static_cast<size_t>(by) * levelWidth + bx] = static_cast<std::uint8_t>((sum + 2) / 4);
+        }
+    }
+}
+
+size_t DensityPyramid::memoryBytes() const {
+    size_t bytes = 0;
+    for (const auto& level : m_levels) {
+        bytes += level.size();
+    }
+    return bytes;
+}
@@ -1,8 +1,11 @@
 #include "grid/Grid.hpp"
 #include "cell/AliveState.hpp"
 #include "cell/DeadState.hpp"
+#include "util/Metrics.hpp"
+#include "util/Tracer.hpp"
 #include <sstream>
 #include <thread>
+#include <atomic>
 #include <algorithm>
 #include <stdexcept>
 
@@ -24,6 +27,55 @@ Grid::Grid(int width, int height, bool toroidal)
     }
 }
 
+Grid::Grid(int width, int height, const std::vector<std::uint8_t>& codes, bool toroidal)
+    : m_width(width)
+    , m_height(height)
+    , m_toroidal(toroidal)
+{
+    if (width <= 0 || height <= 0) {
+        throw std::invalid_argument("Grid dimensions must be positive");
+    }
+    if (codes.size() != static_cast<size_t>(width) * height) {
+        throw std::invalid_argument("Cell code count does not match grid dimensions");
+    }
+    for (std::uint8_t code : codes) {
+        if (code > 3) {
+            throw std::invalid_argument("Invalid cell code: " + std::to_string(code));
+        }
+    }
+    
+    m_cells.resize(height);
+    
+    auto buildRows = [this, &codes](int startY, int endY) {
+        for (int y = startY; y < endY; ++y) {
+            const std::uint8_t* row = codes.data() + static_cast<size_t>(y) * m_width;
+            m_cells[y].reserve(m_width);
+            for (int x = 0; x < m_width; ++x) {
+                m_cells[y].push_back(std::make_unique<Cell>(x, y, CellState::fromCode(row[x])));
+            }
+        }
+    };
+    
+    // Les lignes sont indépendantes : construction parallèle pour les grandes grilles
+    unsigned int numThreads = std::thread::hardware_concurrency();
+    if (numThreads == 0) numThreads = 4;
+    if (codes.size() < 65536 || numThreads < 2 || height < static_cast<int>(numThreads)) {
+        buildRows(0, height);
+        return;
+    }
+    
+    std::vector<std::thread> threads;
+    int rowsPerThread = height / numThreads;
+    for (unsigned int i = 0; i < numThreads; ++i) {
+        int startY = i * rowsPerThread;
+        int endY = (i == numThreads - 1) ? height : (i + 1) * rowsPerThread;
+        threads.emplace_back(buildRows, startY, endY);
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
 Grid::Grid(const Grid& other)
     : m_width(other.m_width)
     , m_height(other.m_height)
@@ -39,19 +91,35 @@ Grid::Grid(const Grid& other)
 }
 
 Grid& Grid::operator=(const Grid& other) {
-    if (this != &other) {
-        m_width = other.m_width;
-        m_height = other.m_height;
+    if (this == &other) {
+        return *this;
+    }
+    
+    // Mêmes dimensions : les cellules existantes sont conservées, seuls les états différents sont remplacés
+    if (m_width == other.m_width && m_height == other.m_height) {
         m_toroidal = other.m_toroidal;
-        
-        m_cells.clear();
-        m_cells.resize(m_height);
         for (int y = 0; y < m_height; ++y) {
-            m_cells[y].reserve(m_width);
             for (int x = 0; x < m_width; ++x) {
-                m_cells[y].push_back(std::make_unique<Cell>(*other.m_cells[y][x]));
+                const CellState& state = other.m_cells[y][x]->getState();
+                if (m_cells[y][x]->getState().toCode() != state.toCode()) {
+                    m_cells[y][x]->setState(state.clone());
+                }
             }
         }
+        return *this;
+    }
+    
+    m_width = other.m_width;
+    m_height = other.m_height;
+    m_toroidal = other.m_toroidal;
+    
+    m_cells.clear();
+    m_cells.resize(m_height);
+    for (int y = 0; y < m_height; ++y) {
+        m_cells[y].reserve(m_width);
+        for (int x = 0; x < m_width; ++x) {
+            m_cells[y].push_back(std::make_unique<Cell>(*other.m_cells[y][x]));
+        }
     }
     return *this;
 }
@@ -131,16 +199,19 @@ int Grid::countAliveNeighbors(int x, int y) const {
     return count;
 }
 
-void Grid::update(const Rule& rule, bool parallel) {
-    if (parallel) {
-        // Version parallélisée
-        unsigned int numThreads = std::thread::hardware_concurrency();
-        if (numThreads == 0) numThreads = 4;
-        
-        std::vector<std::thread> threads;
-        int rowsPerThread = m_height / numThreads;
-        
-        auto processRows = [this, &rule](int startY, int endY) {
+void Grid::update(const Rule& rule, bool parallel, unsigned int threadCount, int bandRows) {
+    // Mesurées, les phases de comptage et d'application de la règle sont séparées en deux
+    // parcours ; sinon chaque cellule est traitée en un seul passage
+    const bool timed = Metrics::isEnabled();
+    if (timed) {
+        m_neighborCounts.resize(static_cast<size_t>(m_width) * m_height);
+    }
+    
+    auto processRows = [this, &rule, timed](int startY, int endY) {
+        TraceSpan span("Grid::update rows", "simulation");
+        span.addArg("startY", startY);
+        span.addArg("endY", endY);
+        if (!timed) {
             for (int y = startY; y < endY; ++y) {
                 for (int x = 0; x < m_width; ++x) {
                     Cell& cell = *m_cells[y][x];
@@ -154,20 +225,23 @@ void Grid::update(const Rule& rule, bool parallel) {
                     }
                 }
             }
-        };
-        
-        for (unsigned int i = 0; i < numThreads; ++i) {
-            int startY = i * rowsPerThread;
-            int endY = (i == numThreads - 1) ? m_height : (i + 1) * rowsPerThread;
-            threads.emplace_back(processRows, startY, endY);
+            return;
         }
         
-        for (auto& thread : threads) {
-            thread.join();
+        {
+            ScopedTimer timer(Metrics::Phase::NeighborCount);
+            for (int y = startY; y < endY; ++y) {
+                for (int x = 0; x < m_width; ++x) {
+                    if (!m_cells[y][x]->isObstacle()) {
+                        m_neighborCounts[static_cast<size_t>(y) * m_width + x] =
+                            static_cast<std::uint8_t>(countAliveNeighbors(x, y));
+                    }
+                }
+            }
         }
-    } else {
-        // Version séquentielle
-        for (int y = 0; y < m_height; ++y) {
+        
+        ScopedTimer timer(Metrics::Phase::RuleApply);
+        for (int y = startY; y < endY; ++y) {
             for (int x = 0; x < m_width; ++x) {
                 Cell& cell = *m_cells[y][x];
                 
@@ -175,14 +249,51 @@ void Grid::update(const Rule& rule, bool parallel) {
                 if (cell.isObstacle()) {
                     cell.setNextState(cell.getState().clone());
                 } else {
-                    int neighbors = countAliveNeighbors(x, y);
+                    int neighbors = m_neighborCounts[static_cast<size_t>(y) * m_width + x];
                     cell.setNextState(rule.computeNextState(cell.isAlive(), neighbors));
                 }
             }
         }
+    };
+    
+    if (parallel) {
+        // Version parallélisée
+        unsigned int numThreads = threadCount;
+        if (numThreads == 0) numThreads = std::thread::hardware_concurrency();
+        if (numThreads == 0) numThreads = 4;
+        
+        std::vector<std::thread> threads;
+        int rowsPerThread = m_height / numThreads;
+        std::atomic<int> nextBand(0);
+        
+        for (unsigned int i = 0; i < numThreads; ++i) {
+            int startY = i * rowsPerThread;
+            int endY = (i == numThreads - 1) ? m_height : (i + 1) * rowsPerThread;
+            threads.emplace_back([this, &processRows, &nextBand, bandRows, i, startY, endY]() {
+                // Une piste par tranche : les threads sont recréés à chaque génération
+                if (Tracer::isEnabled()) Tracer::setThreadName("worker " + std::to_string(i));
+                if (bandRows <= 0) {
+                    processRows(startY, endY);
+                    return;
+                }
+                // Bandes de bandRows lignes prises à tour de rôle : équilibre les grilles inégales
+                for (int band = nextBand++; band * bandRows < m_height; band = nextBand++) {
+                    processRows(band * bandRows, std::min(m_height, (band + 1) * bandRows));
+                }
+            });
+        }
+        
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    } else {
+        // Version séquentielle
+        processRows(0, m_height);
     }
     
     // Applique tous les nouveaux états
+    TraceSpan span("Grid::applyNextState", "simulation");
+    ScopedTimer timer(Metrics::Phase::StateApply);
     for (int y = 0; y < m_height; ++y) {
         for (int x = 0; x < m_width; ++x) {
             m_cells[y][x]->applyNextState();
@@ -205,6 +316,27 @@ bool Grid::equals(const Grid& other) const {
     return true;
 }
 
+size_t Grid::memoryBytes() const {
+    // Chaque cellule et son état sont alloués séparément ; les états n'ont pas de données
+    size_t bytes = m_cells.capacity() * sizeof(m_cells[0]) + m_neighborCounts.capacity();
+    for (const auto& row : m_cells) {
+        bytes += row.capacity() * sizeof(std::unique_ptr<Cell>);
+    }
+    bytes += static_cast<size_t>(m_width) * m_height * (sizeof(Cell) + sizeof(AliveState));
+    return bytes;
+}
+
+std::uint64_t Grid::hash() const {
+    std::uint64_t hash = 14695981039346656037ULL;
+    for (int y = 0; y < m_height; ++y) {
+        for (int x = 0; x < m_width; ++x) {
+            hash ^= m_cells[y][x]->isAlive() ? 1u : 0u;
+            hash *= 1099511628211ULL;
+        }
+    }
+    return hash;
+}
+
 std::string Grid::toString() const {
     std::ostringstream oss;
     for (int y = 0; y < m_height; ++y) {
@@ -243,5 +375,38 @@ void Grid::placePattern(const std::vector<std::vector<bool>>& pattern, int start
     }
 }
 
+std::vector<std::uint8_t> Grid::toCodes() const {
+    std::vector<std::uint8_t> codes;
+    toCodes(codes);
+    return codes;
+}
 
+void Grid::toCodes(std::vector<std::uint8_t>& codes) const {
+    codes.resize(static_cast<size_t>(m_width) * m_height);
+    std::uint8_t* code = codes.data();
+    for (int y = 0; y < m_height; ++y) {
+        for (int x = 0; x < m_width; ++x) {
+            *code++ = static_cast<std::uint8_t>(m_cells[y][x]->getState().toCode());
+        }
+    }
+}
 
+void Grid::fromCodes(const std::vector<std::uint8_t>& codes) {
+    if (codes.size() != static_cast<size_t>(m_width) * m_height) {
+        throw std::invalid_argument("Cell code count does not match grid dimensions");
+    }
+    
+    size_t i = 0;
+    for (int y = 0; y < m_height; ++y) {
+        for (int x = 0; x < m_width; ++x, ++i) {
+            // Évite une allocation si l'état est déjà le bon
+            if (m_cells[y][x]->getState().toCode() == codes[i]) continue;
+            
+            auto state = CellState::fromCode(codes[i]);
+            if (!state) {
+                throw std::invalid_argument("Invalid cell code: " + std::to_string(codes[i]));
+            }
+            m_cells[y][x]->setState(std::move(state));
+        }
+    }
+}
@@ -0,0 +1,322 @@
+#include "grid/QuadTree.hpp"
+#include <stdexcept>
+#include <algorithm>
+#include <climits>
+#include <cstring>
+
+namespace {
+
+inline int popcount64(std::uint64_t value) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_popcountll(value);
+#else
+    int count = 0;
+    while (value) {
+        value &= value - 1;
+        ++count;
+    }
+    return count;
+#endif
+}
+
+/**
+ * @brief Rectangle englobant (coordonnées relatives au coin du nœud)
+ */
+struct Bounds {
+    long long minX, minY, maxX, maxY;
+};
+
+} // namespace
+
+// ============================================================================
+// QuadTree
+// ============================================================================
+
+QuadTree::QuadTree(int width, int height)
+    : m_root(EMPTY)
+    , m_rootLevel(LEAF_LEVEL)
+    , m_originX(0)
+    , m_originY(0)
+    , m_width(width)
+    , m_height(height)
+{
+    if (width <= 0 || height <= 0) {
+        throw std::invalid_argument("Grid dimensions must be positive");
+    }
+
+    // Nœud 0 : carré vide
+    m_nodes.push_back({-1, {EMPTY, EMPTY, EMPTY, EMPTY}, 0, 0, 0, false});
+
+    while ((1LL << m_rootLevel) < std::max(width, height)) {
+        ++m_rootLevel;
+    }
+}
+
+QuadTree::NodeId QuadTree::makeLeaf(std::uint64_t alive, std::uint64_t obstacle) {
+    if (alive == 0 && obstacle == 0) return EMPTY;
+
+    Key key{alive, obstacle};
+    auto it = m_leafIndex.find(key);
+    if (it != m_leafIndex.end()) return it->second;
+
+    NodeId id = static_cast<NodeId>(m_nodes.size());
+    m_nodes.push_back({LEAF_LEVEL, {EMPTY, EMPTY, EMPTY, EMPTY}, alive, obstacle, popcount64(alive), obstacle != 0});
+    m_leafIndex.emplace(key, id);
+    return id;
+}
+
+QuadTree::NodeId QuadTree::makeNode(int level, NodeId nw, NodeId ne, NodeId sw, NodeId se) {
+    if (level <= LEAF_LEVEL || level > MAX_LEVEL) {
+        throw std::invalid_argument("Invalid quadtree node level: " + std::to_string(level));
+    }
+
+    const NodeId children[4] = {nw, ne, sw, se};
+    Node node{level, {nw, ne, sw, se}, 0, 0, 0, false};
+    for (NodeId child : children) {
+        if (child == EMPTY) continue;
+        if (child >= m_nodes.size() || m_nodes[child].level != level - 1) {
+            throw std::invalid_argument("Invalid quadtree child for level " + std::to_string(level));
+        }
+        node.population += m_nodes[child].population;
+        node.hasObstacles = node.hasObstacles || m_nodes[child].hasObstacles;
+    }
+    if (nw == EMPTY && ne == EMPTY && sw == EMPTY && se == EMPTY) return EMPTY;
+
+    // Les enfants déterminent le niveau : la clé n'a pas besoin de l'inclure
+    Key key{static_cast<std::uint64_t>(nw) | (static_cast<std::uint64_t>(ne) << 32),
+            static_cast<std::uint64_t>(sw) | (static_cast<std::uint64_t>(se) << 32)};
+    auto it = m_nodeIndex.find(key);
+    if (it != m_nodeIndex.end()) return it->second;
+
+    NodeId id = static_cast<NodeId>(m_nodes.size());
+    m_nodes.push_back(node);
+    m_nodeIndex.emplace(key, id);
+    return id;
+}
+
+void QuadTree::setRoot(NodeId root, int level) {
+    if (level < LEAF_LEVEL || level > MAX_LEVEL) {
+        throw std::invalid_argument("Invalid quadtree root level: " + std::to_string(level));
+    }
+    if (root >= m_nodes.size() || (root != EMPTY && m_nodes[root].level != level)) {
+        throw std::invalid_argument("Invalid quadtree root");
+    }
+    long long size = 1LL << level;
+    if (m_originX + m_width > size || m_originY + m_height > size) {
+        throw std::invalid_argument("Grid window exceeds quadtree root");
+    }
+
+    m_root = root;
+    m_rootLevel = level;
+}
+
+void QuadTree::setWindow(long long originX, long long originY, int width, int height) {
+    long long size = 1LL << m_rootLevel;
+    if (width <= 0 || height <= 0) {
+        throw std::invalid_argument("Grid dimensions must be positive");
+    }
+    if (originX < 0 || originY < 0 || originX + width > size || originY + height > size) {
+        throw std::invalid_argument("Grid window exceeds quadtree root");
+    }
+
+    m_originX = originX;
+    m_originY = originY;
+    m_width = width;
+    m_height = height;
+}
+
+bool QuadTree::cropToContent() {
+    if (m_root == EMPTY) return false;
+
+    // Les enfants sont toujours créés avant leurs parents : un seul parcours suffit
+    std::vector<Bounds> bounds(m_nodes.size());
+    for (size_t id = 1; id < m_nodes.size(); ++id) {
+        const Node& node = m_nodes[id];
+        Bounds& b = bounds[id];
+        b = {LLONG_MAX, LLONG_MAX, LLONG_MIN, LLONG_MIN};
+
+        if (node.level == LEAF_LEVEL) {
+            std::uint64_t bits = node.alive | node.obstacle;
+            for (int i = 0; i < 64; ++i) {
+                if ((bits >> i) & 1) {
+                    b.minX = std::min<long long>(b.minX, i % 8);
+                    b.maxX = std::max<long long>(b.maxX, i % 8);
+                    b.minY = std::min<long long>(b.minY, i / 8);
+                    b.maxY = std::max<long long>(b.maxY, i / 8);
+                }
+            }
+            continue;
+        }
+
+        long long half = 1LL << (node.level - 1);
+        for (int q = 0; q < 4; ++q) {
+            if (node.children[q] == EMPTY) continue;
+            const Bounds& c = bounds[node.children[q]];
+            long long dx = (q % 2) * half;
+            long long dy = (q / 2) * half;
+            b.minX = std::min(b.minX, c.minX + dx);
+            b.maxX = std::max(b.maxX, c.maxX + dx);
+            b.minY = std::min(b.minY, c.minY + dy);
+            b.maxY = std::max(b.maxY, c.maxY + dy);
+        }
+    }
+
+    const Bounds& b = bounds[m_root];
+    if (b.maxX - b.minX + 1 > INT_MAX || b.maxY - b.minY + 1 > INT_MAX) {
+        throw std::runtime_error("Pattern too large for a grid");
+    }
+    m_width = static_cast<int>(b.maxX - b.minX + 1);
+    m_height = static_cast<int>(b.maxY - b.minY + 1);
+    m_originX = b.minX;
+    m_originY = b.minY;
+    return true;
+}
+
+void QuadTree::fillRow(NodeId id, int level, long long nodeX, long long y,
+                       long long fromX, long long toX, std::uint8_t* rowCodes) const {
+    if (id == EMPTY) return;
+    long long size = 1LL << level;
+    if (nodeX >= toX || nodeX + size <= fromX) return;
+
+    const Node& node = m_nodes[id];
+    if (level == LEAF_LEVEL) {
+        unsigned aliveRow = static_cast<unsigned>(node.alive >> (y * 8)) & 0xFF;
+        unsigned obstacleRow = static_cast<unsigned>(node.obstacle >> (y * 8)) & 0xFF;
+        for (int x = 0; x < 8; ++x) {
+            long long cellX = nodeX + x;
+            if (cellX < fromX || cellX >= toX) continue;
+            rowCodes[cellX - fromX] = static_cast<std::uint8_t>(((aliveRow >> x) & 1) | (((obstacleRow >> x) & 1) << 1));
+        }
+        return;
+    }
+
+    long long half = size / 2;
+    int top = (y < half) ? 0 : 2;
+    long long childY = (y < half) ? y : y - half;
+    fillRow(node.children[top], level - 1, nodeX, childY, fromX, toX, rowCodes);
+    fillRow(node.children[top + 1], level - 1, nodeX + half, childY, fromX, toX, rowCodes);
+}
+
+void QuadTree::fillRow(int y, std::uint8_t* rowCodes) const {
+    std::memset(rowCodes, 0, static_cast<size_t>(m_width));
+    fillRow(m_root, m_rootLevel, 0, m_originY + y, m_originX, m_originX + m_width, rowCodes);
+}
+
+std::unique_ptr<Grid> QuadTree::toGrid(bool toroidal) const {
+    std::vector<std::uint8_t> codes(static_cast<size_t>(m_width) * m_height);
+    for (int y = 0; y < m_height; ++y) {
+        fillRow(y, codes.data() + static_cast<size_t>(y) * m_width);
+    }
+    return std::make_unique<Grid>(m_width, m_height, codes, toroidal);
+}
+
+// ============================================================================
+// QuadTreeBuilder
+// ============================================================================
+
+QuadTreeBuilder::QuadTreeBuilder(int width, int height)
+    : m_tree(std::make_unique<QuadTree>(width, height))
+    , m_width(width)
+    , m_height(height)
+    , m_rootLevel(m_tree->getRootLevel())
+    , m_nextRow(0)
+    , m_alive((static_cast<size_t>(width) + 7) / 8, 0)
+    , m_obstacle((static_cast<size_t>(width) + 7) / 8, 0)
+    , m_pending(m_rootLevel + 1)
+    , m_hasPending(m_rootLevel + 1, false)
+{
+}
+
+std::vector<QuadTree::NodeId> QuadTreeBuilder::mergeRows(int level, const std::vector<QuadTree::NodeId>& top,
+                                                         const std::vector<QuadTree::NodeId>& bottom) {
+    // Les nœuds au-delà de la fin d'une rangée sont vides
+    auto at = [](const std::vector<QuadTree::NodeId>& row, size_t i) {
+        return i < row.size() ? row[i] : QuadTree::EMPTY;
+    };
+
+    std::vector<QuadTree::NodeId> merged((std::max(top.size(), bottom.size()) + 1) / 2);
+    for (size_t i = 0; i < merged.size(); ++i) {
+        merged[i] = m_tree->makeNode(level + 1, at(top, 2 * i), at(top, 2 * i + 1),
+                                     at(bottom, 2 * i), at(bottom, 2 * i + 1));
+    }
+    return merged;
+}
+
+void QuadTreeBuilder::pushRow(int level, std::vector<QuadTree::NodeId> row) {
+    // Comme un compteur binaire : deux rangées d'un niveau forment une rangée du niveau supérieur
+    while (level < m_rootLevel && m_hasPending[level]) {
+        row = mergeRows(level, m_pending[level], row);
+        m_pending[level].clear();
+        m_hasPending[level] = false;
+        ++level;
+    }
+    m_pending[level] = std::move(row);
+    m_hasPending[level] = true;
+}
+
+void QuadTreeBuilder::flushStrip() {
+    std::vector<QuadTree::NodeId> leaves(m_alive.size());
+    for (size_t i = 0; i < leaves.size(); ++i) {
+        leaves[i] = m_tree->makeLeaf(m_alive[i], m_obstacle[i]);
+    }
+    std::fill(m_alive.begin(), m_alive.end(), 0);
+    std::fill(m_obstacle.begin(), m_obstacle.end(), 0);
+    pushRow(QuadTree::LEAF_LEVEL, std::move(leaves));
+}
+
+void QuadTreeBuilder::addRow(const std::uint8_t* rowCodes) {
+    if (!m_tree || m_nextRow >= m_height) {
+        throw std::logic_error("All rows have already been added");
+    }
+
+    int shift = (m_nextRow % 8) * 8;
+    for (int x = 0; x < m_width; ++x) {
+        std::uint8_t code = rowCodes[x];
+        if (code == 0) continue;
+        std::uint64_t bit = 1ULL << (shift + (x & 7));
+        if (code & 1) m_alive[x >> 3] |= bit;
+        if (code & 2) m_obstacle[x >> 3] |= bit;
+    }
+
+    ++m_nextRow;
+    if (m_nextRow % 8 == 0) {
+        flushStrip();
+    }
+}
+
+std::unique_ptr<QuadTree> QuadTreeBuilder::finish() {
+    if (!m_tree) {
+        throw std::logic_error("Quadtree already built");
+    }
+    if (m_nextRow % 8 != 0) {
+        flushStrip();
+    }
+
+    // Les rangées restantes sont complétées par des rangées vides
+    for (int level = QuadTree::LEAF_LEVEL; level < m_rootLevel; ++level) {
+        if (!m_hasPending[level]) continue;
+        std::vector<QuadTree::NodeId> merged = mergeRows(level, m_pending[level], {});
+        m_pending[level].clear();
+        m_hasPending[level] = false;
+        pushRow(level + 1, std::move(merged));
+    }
+
+    QuadTree::NodeId root = QuadTree::EMPTY;
+    if (m_hasPending[m_rootLevel] && !m_pending[m_rootLevel].empty()) {
+        root = m_pending[m_rootLevel][0];
+    }
+    m_tree->setRoot(root, m_rootLevel);
+    return std::move(m_tree);
+}
+
+std::unique_ptr<QuadTree> QuadTreeBuilder::fromGrid(const Grid& grid) {
+    QuadTreeBuilder builder(grid.getWidth(), grid.getHeight());
+    std::vector<std::uint8_t> row(grid.getWidth());
+    for (int y = 0; y < grid.getHeight(); ++y) {
+        for (int x = 0; x < grid.getWidth(); ++x) {
+            row[x] = static_cast<std::uint8_t>(grid.getCell(x, y).getState().toCode());
+        }
+        builder.addRow(row.data());
+    }
+    return builder.finish();
+}
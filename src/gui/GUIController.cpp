@@ -4,110 +4,235 @@
 #include "cell/ObstacleAliveState.hpp"
 #include "cell/ObstacleDeadState.hpp"
 #include "io/FileHandler.hpp"
+#include "util/Tracer.hpp"
 #include <iostream>
 #include <ctime>
 #include <sstream>
 #include <iomanip>
+#include <algorithm>
+#include <cstdlib>
 
 GUIController::GUIController(Game& game, int width, int height, int cellSize)
     : m_window(sf::VideoMode(width, height), "Jeu de la Vie - Conway's Game of Life", 
                sf::Style::Titlebar | sf::Style::Close)
-    , m_game(game)
     , m_renderer(m_window, cellSize)
     , m_updateInterval(100)
+    , m_turboRateIndex(0)
     , m_showHelp(false)
     , m_selectedPattern("glider")
     , m_patternIndex(0)
-    , m_parallel(false)
+    , m_parallel(game.isParallel())
     , m_initialGrid(std::make_unique<Grid>(game.getGrid()))
     , m_saveFilename("save")
     , m_saveCounter(0)
+    , m_panning(false)
+    , m_panStartX(0)
+    , m_panStartY(0)
+    , m_panCameraX(0)
+    , m_panCameraY(0)
+    , m_needsRedraw(true)
+    , m_showPerf(false)
+    , m_frameClockValid(false)
+    , m_fpsFrames(0)
+    , m_simulation(game, m_updateInterval)
 {
     m_window.setFramerateLimit(60);
+    m_perf.frameTimes = &m_frameTimes;
 }
 
 void GUIController::run() {
     // Ne démarre PAS automatiquement - l'utilisateur doit appuyer sur ESPACE
-    m_game.pause();
+    m_simulation.submit([](Game& game) { game.pause(); });
     
     while (m_window.isOpen()) {
-        handleEvents();
-        update();
-        render();
+        if (!m_needsRedraw && isIdle()) {
+            // Rien ne change sans l'utilisateur : attente bloquante du prochain événement
+            sf::Event event;
+            if (m_window.waitEvent(event)) {
+                handleEvent(event);
+            }
+            m_frameClockValid = false;
+        }
+        sf::Clock stepClock;
+        {
+            TraceSpan span("GUIController::handleEvents", "gui");
+            handleEvents();
+        }
+        m_perf.eventsMs = stepClock.restart().asMicroseconds() / 1000.f;
+        {
+            TraceSpan span("GUIController::update", "gui");
+            update();
+        }
+        m_perf.updateMs = stepClock.restart().asMicroseconds() / 1000.f;
+        if (m_needsRedraw) {
+            TraceSpan span("GUIController::render", "gui");
+            render();
+            m_needsRedraw = false;
+        } else {
+            // Simulation en cours mais pas de nouvelle génération : courte attente
+            // (SFML 2.5 n'offre pas d'attente d'événement avec délai)
+            sf::sleep(sf::milliseconds(IDLE_POLL_MS));
+        }
     }
 }
 
+bool GUIController::isIdle() const {
+    return !m_simulation.getFrame().running && m_pendingSave.empty() && m_simulation.isIdle();
+}
+
+void GUIController::enableTurbo(int generationsPerSecond) {
+    // Débit proposé le plus proche de celui demandé
+    m_turboRateIndex = 0;
+    if (generationsPerSecond > 0) {
+        for (int i = 1; i < TURBO_RATE_COUNT; ++i) {
+            if (std::abs(TURBO_RATES[i] - generationsPerSecond) <
+                std::abs(TURBO_RATES[m_turboRateIndex] - generationsPerSecond)) {
+                m_turboRateIndex = i;
+            }
+        }
+    }
+    m_simulation.setTurbo(true, TURBO_RATES[m_turboRateIndex]);
+}
+
 void GUIController::handleEvents() {
     sf::Event event;
     while (m_window.pollEvent(event)) {
-        switch (event.type) {
-            case sf::Event::Closed:
-                m_window.close();
-                break;
-                
-            case sf::Event::KeyPressed:
-                handleKeyPress(event);
-                break;
-                
-            case sf::Event::MouseButtonPressed:
-                handleMouseClick(event);
-                break;
-                
-            case sf::Event::MouseWheelScrolled:
-                handleMouseWheel(event);
-                break;
-                
-            default:
-                break;
-        }
+        handleEvent(event);
+    }
+}
+
+void GUIController::handleEvent(const sf::Event& event) {
+    if (event.type != sf::Event::MouseMoved || m_panning) {
+        m_needsRedraw = true;
+    }
+    
+    switch (event.type) {
+        case sf::Event::Closed:
+            m_window.close();
+            break;
+            
+        case sf::Event::KeyPressed:
+            handleKeyPress(event);
+            break;
+            
+        case sf::Event::MouseButtonPressed:
+            handleMouseClick(event);
+            break;
+            
+        case sf::Event::MouseButtonReleased:
+            if (event.mouseButton.button == sf::Mouse::Middle) {
+                m_panning = false;
+            }
+            break;
+            
+        case sf::Event::MouseMoved:
+            handleMouseMove(event);
+            break;
+            
+        case sf::Event::MouseWheelScrolled:
+            handleMouseWheel(event);
+            break;
+            
+        default:
+            break;
     }
 }
 
 void GUIController::update() {
-    if (m_game.isRunning() && !m_game.isFinished()) {
-        if (m_clock.getElapsedTime().asMilliseconds() >= m_updateInterval) {
-            m_game.step();
-            m_clock.restart();
-        }
+    // Les générations sont calculées par le thread de simulation : seule la plus récente est affichée
+    if (m_simulation.fetchFrame()) {
+        m_needsRedraw = true;
+    }
+    
+    std::string error = m_simulation.takeError();
+    if (!error.empty()) {
+        std::cerr << "Erreur: " << error << std::endl;
+    }
+    
+    checkSaveStatus();
+}
+
+void GUIController::checkSaveStatus() {
+    if (m_pendingSave.empty() || m_saveWriter.pending() > 0) return;
+    
+    std::string error = m_saveWriter.takeError();
+    if (error.empty()) {
+        std::cout << "Sauvegarde effectuee: " << m_pendingSave << std::endl;
+        m_renderer.setStatus("Sauvegarde: " + m_pendingSave, false);
+    } else {
+        std::cerr << "Erreur de sauvegarde: " << error << std::endl;
+        m_renderer.setStatus("Erreur de sauvegarde: " + error, true);
     }
+    m_pendingSave.clear();
+    m_needsRedraw = true;
 }
 
 void GUIController::render() {
+    sf::Clock renderClock;
+    const SimulationFrame& frame = m_simulation.getFrame();
     m_window.clear(sf::Color(20, 20, 25));
     
     // Panneau latéral
-    m_renderer.renderSidePanel(m_selectedPattern, m_game.getGrid().isToroidal(), m_parallel);
+    m_renderer.renderSidePanel(m_selectedPattern, frame.toroidal, m_parallel);
     
     // Grille
-    m_renderer.render(m_game.getGrid());
+    m_renderer.render(frame);
     
     // Panneau info en haut avec statistiques
-    m_renderer.renderInfoPanel(m_game.getIteration(), m_game.isRunning(), 
-                               m_updateInterval, m_game.getGrid().isToroidal(), m_parallel,
-                               m_game.countAliveCells(), m_game.isStable(),
-                               m_game.getGrid().getWidth(), m_game.getGrid().getHeight());
+    m_renderer.renderInfoPanel(frame.iteration, frame.running, 
+                               m_updateInterval, frame.toroidal, m_parallel,
+                               frame.population, frame.stable,
+                               frame.width, frame.height,
+                               frame.turbo, TURBO_RATES[m_turboRateIndex],
+                               static_cast<int>(frame.generationsPerSecond + 0.5));
     
     // Aide si activée
     if (m_showHelp) {
         m_renderer.renderHelp();
     }
     
+    // Panneau de performances (durée de rendu de l'image précédente)
+    if (m_showPerf) {
+        m_perf.stepMs = frame.stepMilliseconds;
+        m_perf.generationsPerSecond = frame.running ? frame.generationsPerSecond : 0.0;
+        m_perf.gridBytes = frame.memoryBytes;
+        m_renderer.renderPerfOverlay(m_perf);
+    }
+    m_perf.renderMs = renderClock.getElapsedTime().asMicroseconds() / 1000.f;
+    
     m_window.display();
+    
+    // Durée d'image : intervalle entre deux affichages, sauf après une attente d'événement
+    if (m_frameClockValid) {
+        m_frameTimes.push(m_frameClock.restart().asMicroseconds() / 1000.f);
+    } else {
+        m_frameClock.restart();
+        m_frameClockValid = true;
+    }
+    ++m_fpsFrames;
+    const float fpsElapsed = m_fpsClock.getElapsedTime().asSeconds();
+    if (fpsElapsed >= 0.5f) {
+        m_perf.framesPerSecond = m_fpsFrames / fpsElapsed;
+        m_fpsFrames = 0;
+        m_fpsClock.restart();
+    }
 }
 
 void GUIController::handleKeyPress(const sf::Event& event) {
+    const SimulationFrame& frame = m_simulation.getFrame();
+    
     switch (event.key.code) {
         case sf::Keyboard::Escape:
             m_window.close();
             break;
             
         case sf::Keyboard::Space:
-            m_game.togglePause();
+            m_simulation.submit([](Game& game) { game.togglePause(); });
             break;
             
         case sf::Keyboard::S:
             // Avance d'une seule itération (même en pause)
-            m_game.step();
+            m_simulation.submit([](Game& game) { game.step(); });
             break;
             
         case sf::Keyboard::C:
@@ -129,19 +254,30 @@ void GUIController::handleKeyPress(const sf::Event& event) {
             break;
             
         case sf::Keyboard::T:
-            m_game.getGrid().setToroidal(!m_game.getGrid().isToroidal());
+            m_simulation.submit([](Game& game) { game.getGrid().setToroidal(!game.getGrid().isToroidal()); });
             break;
             
-        case sf::Keyboard::P:
+        case sf::Keyboard::P: {
             m_parallel = !m_parallel;
-            m_game.setParallel(m_parallel);
+            bool parallel = m_parallel;
+            m_simulation.submit([parallel](Game& game) { game.setParallel(parallel); });
             break;
+        }
         
         case sf::Keyboard::F5:
             // Sauvegarde l'état actuel
             saveCurrentState();
             break;
             
+        case sf::Keyboard::F3:
+            m_showPerf = !m_showPerf;
+            break;
+            
+        case sf::Keyboard::Home:
+            // Revient au coin supérieur gauche de la grille
+            m_renderer.setCamera(0, 0);
+            break;
+            
         case sf::Keyboard::LBracket:
             // [ : Diminue la taille de la grille
             decreaseGridSize(5);
@@ -156,7 +292,9 @@ void GUIController::handleKeyPress(const sf::Event& event) {
             if (sf::Keyboard::isKeyPressed(sf::Keyboard::LControl) ||
                 sf::Keyboard::isKeyPressed(sf::Keyboard::RControl)) {
                 // Ctrl+Haut : Augmente la hauteur
-                resizeGrid(m_game.getGrid().getWidth(), m_game.getGrid().getHeight() + 5);
+                resizeGrid(frame.width, frame.height + 5);
+            } else if (event.key.shift) {
+                panView(0, -1);
             }
             break;
             
@@ -164,7 +302,9 @@ void GUIController::handleKeyPress(const sf::Event& event) {
             if (sf::Keyboard::isKeyPressed(sf::Keyboard::LControl) ||
                 sf::Keyboard::isKeyPressed(sf::Keyboard::RControl)) {
                 // Ctrl+Bas : Diminue la hauteur
-                resizeGrid(m_game.getGrid().getWidth(), m_game.getGrid().getHeight() - 5);
+                resizeGrid(frame.width, frame.height - 5);
+            } else if (event.key.shift) {
+                panView(0, 1);
             }
             break;
             
@@ -172,7 +312,9 @@ void GUIController::handleKeyPress(const sf::Event& event) {
             if (sf::Keyboard::isKeyPressed(sf::Keyboard::LControl) ||
                 sf::Keyboard::isKeyPressed(sf::Keyboard::RControl)) {
                 // Ctrl+Droite : Augmente la largeur
-                resizeGrid(m_game.getGrid().getWidth() + 5, m_game.getGrid().getHeight());
+                resizeGrid(frame.width + 5, frame.height);
+            } else if (event.key.shift) {
+                panView(1, 0);
             } else {
                 // Droite seule : Pattern suivant
                 nextPattern();
@@ -183,27 +325,48 @@ void GUIController::handleKeyPress(const sf::Event& event) {
             if (sf::Keyboard::isKeyPressed(sf::Keyboard::LControl) ||
                 sf::Keyboard::isKeyPressed(sf::Keyboard::RControl)) {
                 // Ctrl+Gauche : Diminue la largeur
-                resizeGrid(m_game.getGrid().getWidth() - 5, m_game.getGrid().getHeight());
+                resizeGrid(frame.width - 5, frame.height);
+            } else if (event.key.shift) {
+                panView(-1, 0);
             } else {
                 // Gauche seule : Pattern précédent
                 previousPattern();
             }
             break;
             
+        case sf::Keyboard::F:
+            // Mode turbo : générations enchaînées, seule la dernière de chaque image est affichée
+            m_simulation.setTurbo(!m_simulation.isTurbo(), TURBO_RATES[m_turboRateIndex]);
+            break;
+            
         case sf::Keyboard::Add:
         case sf::Keyboard::Equal:
+            if (m_simulation.isTurbo()) {
+                // Turbo : débit visé supérieur
+                if (m_turboRateIndex > 0) --m_turboRateIndex;
+                m_simulation.setTurbo(true, TURBO_RATES[m_turboRateIndex]);
+                break;
+            }
             // Augmente la vitesse (diminue l'intervalle)
             if (m_updateInterval > 20) {
                 m_updateInterval -= 20;
             }
+            m_simulation.setInterval(m_updateInterval);
             break;
             
         case sf::Keyboard::Subtract:
         case sf::Keyboard::Hyphen:
+            if (m_simulation.isTurbo()) {
+                // Turbo : débit visé inférieur
+                if (m_turboRateIndex < TURBO_RATE_COUNT - 1) ++m_turboRateIndex;
+                m_simulation.setTurbo(true, TURBO_RATES[m_turboRateIndex]);
+                break;
+            }
             // Diminue la vitesse (augmente l'intervalle)
             if (m_updateInterval < 1000) {
                 m_updateInterval += 20;
             }
+            m_simulation.setInterval(m_updateInterval);
             break;
             
         // Sélection de patterns par numéro
@@ -259,9 +422,20 @@ void GUIController::handleKeyPress(const sf::Event& event) {
 }
 
 void GUIController::handleMouseClick(const sf::Event& event) {
+    if (event.mouseButton.button == sf::Mouse::Middle) {
+        // Début du déplacement de la vue
+        m_panning = true;
+        m_panStartX = event.mouseButton.x;
+        m_panStartY = event.mouseButton.y;
+        m_panCameraX = m_renderer.getCameraX();
+        m_panCameraY = m_renderer.getCameraY();
+        return;
+    }
+    
+    const SimulationFrame& frame = m_simulation.getFrame();
     int gridX, gridY;
     
-    if (m_renderer.screenToGrid(event.mouseButton.x, event.mouseButton.y, gridX, gridY, m_game.getGrid())) {
+    if (m_renderer.screenToGrid(event.mouseButton.x, event.mouseButton.y, gridX, gridY, frame.width, frame.height)) {
         bool ctrlPressed = sf::Keyboard::isKeyPressed(sf::Keyboard::LControl) || 
                           sf::Keyboard::isKeyPressed(sf::Keyboard::RControl);
         bool shiftPressed = sf::Keyboard::isKeyPressed(sf::Keyboard::LShift) || 
@@ -270,10 +444,14 @@ void GUIController::handleMouseClick(const sf::Event& event) {
         if (event.mouseButton.button == sf::Mouse::Left) {
             if (ctrlPressed) {
                 // Ctrl+Clic : Créer un obstacle vivant
-                m_game.getGrid().setCellState(gridX, gridY, std::make_unique<ObstacleAliveState>());
+                m_simulation.submit([gridX, gridY](Game& game) {
+                    game.getGrid().setCellState(gridX, gridY, std::make_unique<ObstacleAliveState>());
+                });
             } else if (shiftPressed) {
                 // Shift+Clic : Active juste une cellule
-                m_game.getGrid().setCellState(gridX, gridY, std::make_unique<AliveState>());
+                m_simulation.submit([gridX, gridY](Game& game) {
+                    game.getGrid().setCellState(gridX, gridY, std::make_unique<AliveState>());
+                });
             } else {
                 // Clic simple : Place le pattern
                 placeSelectedPattern(gridX, gridY);
@@ -281,19 +459,38 @@ void GUIController::handleMouseClick(const sf::Event& event) {
         } else if (event.mouseButton.button == sf::Mouse::Right) {
             if (ctrlPressed) {
                 // Ctrl+Clic droit : Créer un obstacle mort
-                m_game.getGrid().setCellState(gridX, gridY, std::make_unique<ObstacleDeadState>());
+                m_simulation.submit([gridX, gridY](Game& game) {
+                    game.getGrid().setCellState(gridX, gridY, std::make_unique<ObstacleDeadState>());
+                });
             } else {
                 // Clic droit : Désactive une cellule (remet à l'état normal mort)
-                m_game.getGrid().setCellState(gridX, gridY, std::make_unique<DeadState>());
+                m_simulation.submit([gridX, gridY](Game& game) {
+                    game.getGrid().setCellState(gridX, gridY, std::make_unique<DeadState>());
+                });
             }
         }
     }
 }
 
+void GUIController::handleMouseMove(const sf::Event& event) {
+    if (!m_panning) return;
+    
+    // La grille suit la souris, à la cellule près
+    m_renderer.setCamera(m_panCameraX - m_renderer.pixelsToCells(event.mouseMove.x - m_panStartX),
+                         m_panCameraY - m_renderer.pixelsToCells(event.mouseMove.y - m_panStartY));
+}
+
+void GUIController::panView(int columns, int rows) {
+    m_renderer.pan(columns * std::max(1, m_renderer.getViewColumns() / 4),
+                   rows * std::max(1, m_renderer.getViewRows() / 4));
+}
+
 void GUIController::placeSelectedPattern(int gridX, int gridY) {
     auto pattern = Patterns::getByName(m_selectedPattern);
     if (!pattern.empty()) {
-        m_game.getGrid().placePattern(pattern, gridX, gridY);
+        m_simulation.submit([pattern, gridX, gridY](Game& game) {
+            game.getGrid().placePattern(pattern, gridX, gridY);
+        });
     }
 }
 
@@ -311,31 +508,35 @@ void GUIController::previousPattern() {
 
 void GUIController::clearGrid() {
     // Efface toutes les cellules
-    Grid& grid = m_game.getGrid();
-    for (int y = 0; y < grid.getHeight(); ++y) {
-        for (int x = 0; x < grid.getWidth(); ++x) {
-            if (!grid.getCell(x, y).isObstacle()) {
-                grid.setCellState(x, y, std::make_unique<DeadState>());
+    m_simulation.submit([](Game& game) {
+        Grid& grid = game.getGrid();
+        for (int y = 0; y < grid.getHeight(); ++y) {
+            for (int x = 0; x < grid.getWidth(); ++x) {
+                if (!grid.getCell(x, y).isObstacle()) {
+                    grid.setCellState(x, y, std::make_unique<DeadState>());
+                }
             }
         }
-    }
-    m_game.pause();
+        game.pause();
+    });
 }
 
 void GUIController::resetGrid() {
     // Remet la grille à l'état initial
-    Grid& grid = m_game.getGrid();
-    for (int y = 0; y < grid.getHeight(); ++y) {
-        for (int x = 0; x < grid.getWidth(); ++x) {
-            if (m_initialGrid->getCell(x, y).isAlive()) {
-                grid.setCellState(x, y, std::make_unique<AliveState>());
-            } else {
-                grid.setCellState(x, y, std::make_unique<DeadState>());
+    m_simulation.submit([this](Game& game) {
+        Grid& grid = game.getGrid();
+        for (int y = 0; y < grid.getHeight(); ++y) {
+            for (int x = 0; x < grid.getWidth(); ++x) {
+                if (m_initialGrid->getCell(x, y).isAlive()) {
+                    grid.setCellState(x, y, std::make_unique<AliveState>());
+                } else {
+                    grid.setCellState(x, y, std::make_unique<DeadState>());
+                }
             }
         }
-    }
-    m_game.pause();
-    m_game.resetIteration();
+        game.pause();
+        game.resetIteration();
+    });
 }
 
 void GUIController::saveCurrentState() {
@@ -350,79 +551,103 @@ void GUIController::saveCurrentState() {
              << std::setw(2) << ltm->tm_sec
              << "_" << m_saveCounter++ << ".txt";
     
-    try {
-        FileHandler::saveToFile(m_game.getGrid(), filename.str());
-        std::cout << "Sauvegarde effectuee: " << filename.str() << std::endl;
-    } catch (const std::exception& e) {
-        std::cerr << "Erreur de sauvegarde: " << e.what() << std::endl;
-    }
+    // Copie des codes de la génération affichée (le jeu appartient au thread de simulation) ;
+    // le formatage et l'écriture se font sur le thread de sauvegarde
+    const SimulationFrame& frame = m_simulation.getFrame();
+    const int width = frame.width;
+    const int height = frame.height;
+    const std::string path = filename.str();
+    m_saveWriter.submit([codes = frame.codes, width, height, path]() {
+        FileHandler::saveCodes(width, height, codes, path);
+    });
+    
+    m_pendingSave = path;
+    m_renderer.setStatus("Sauvegarde en cours: " + path, false);
 }
 
 void GUIController::handleMouseWheel(const sf::Event& event) {
     int currentSize = m_renderer.getCellSize();
+    int currentLevel = m_renderer.getLodLevel();
+    int newSize = currentSize;
+    int newLevel = currentLevel;
     
+    // Pas de 2 pixels, puis de 1 en dessous de 4 ; sous 1 pixel par cellule, chaque cran
+    // double le côté des blocs résumés par un pixel (affichage de densité)
     if (event.mouseWheelScroll.delta > 0) {
         // Zoom avant
-        if (currentSize < 30) {
-            m_renderer.setCellSize(currentSize + 2);
+        if (currentLevel > 0) {
+            newLevel = currentLevel - 1;
+        } else if (currentSize < 30) {
+            newSize = currentSize < 4 ? currentSize + 1 : currentSize + 2;
         }
     } else {
         // Zoom arrière
-        if (currentSize > 4) {
-            m_renderer.setCellSize(currentSize - 2);
+        if (currentSize > 1) {
+            newSize = currentSize <= 4 ? currentSize - 1 : currentSize - 2;
+        } else if (currentLevel < GUIRenderer::MAX_LOD_LEVEL) {
+            newLevel = currentLevel + 1;
         }
     }
+    
+    // La cellule sous la souris reste sous la souris
+    if (newSize != currentSize || newLevel != currentLevel) {
+        m_renderer.zoomAt(event.mouseWheelScroll.x, event.mouseWheelScroll.y, newSize, newLevel);
+    }
 }
 
 void GUIController::resizeGrid(int newWidth, int newHeight) {
     // Limites de taille
     if (newWidth < 10) newWidth = 10;
     if (newHeight < 10) newHeight = 10;
-    if (newWidth > 200) newWidth = 200;
-    if (newHeight > 200) newHeight = 200;
-    
-    Grid& oldGrid = m_game.getGrid();
-    int oldWidth = oldGrid.getWidth();
-    int oldHeight = oldGrid.getHeight();
-    
-    // Si pas de changement, on sort
-    if (newWidth == oldWidth && newHeight == oldHeight) return;
-    
-    // Crée une nouvelle grille
-    auto newGrid = std::make_unique<Grid>(newWidth, newHeight, oldGrid.isToroidal());
-    
-    // Copie les cellules existantes (celles qui rentrent dans la nouvelle taille)
-    int copyWidth = std::min(oldWidth, newWidth);
-    int copyHeight = std::min(oldHeight, newHeight);
+    if (newWidth > MAX_GRID_SIZE) newWidth = MAX_GRID_SIZE;
+    if (newHeight > MAX_GRID_SIZE) newHeight = MAX_GRID_SIZE;
     
-    for (int y = 0; y < copyHeight; ++y) {
-        for (int x = 0; x < copyWidth; ++x) {
-            const Cell& oldCell = oldGrid.getCell(x, y);
-            if (oldCell.isAlive()) {
-                if (oldCell.isObstacle()) {
-                    newGrid->setCellState(x, y, std::make_unique<ObstacleAliveState>());
-                } else {
-                    newGrid->setCellState(x, y, std::make_unique<AliveState>());
+    m_simulation.submit([this, newWidth, newHeight](Game& game) {
+        Grid& oldGrid = game.getGrid();
+        int oldWidth = oldGrid.getWidth();
+        int oldHeight = oldGrid.getHeight();
+        
+        // Si pas de changement, on sort
+        if (newWidth == oldWidth && newHeight == oldHeight) return;
+        
+        // Crée une nouvelle grille
+        auto newGrid = std::make_unique<Grid>(newWidth, newHeight, oldGrid.isToroidal());
+        
+        // Copie les cellules existantes (celles qui rentrent dans la nouvelle taille)
+        int copyWidth = std::min(oldWidth, newWidth);
+        int copyHeight = std::min(oldHeight, newHeight);
+        
+        for (int y = 0; y < copyHeight; ++y) {
+            for (int x = 0; x < copyWidth; ++x) {
+                const Cell& oldCell = oldGrid.getCell(x, y);
+                if (oldCell.isAlive()) {
+                    if (oldCell.isObstacle()) {
+                        newGrid->setCellState(x, y, std::make_unique<ObstacleAliveState>());
+                    } else {
+                        newGrid->setCellState(x, y, std::make_unique<AliveState>());
+                    }
+                } else if (oldCell.isObstacle()) {
+                    newGrid->setCellState(x, y, std::make_unique<ObstacleDeadState>());
                 }
-            } else if (oldCell.isObstacle()) {
-                newGrid->setCellState(x, y, std::make_unique<ObstacleDeadState>());
             }
         }
-    }
-    
-    // Met à jour la grille initiale pour le reset
-    m_initialGrid = std::make_unique<Grid>(*newGrid);
-    
-    // Remplace la grille dans le jeu
-    m_game.reset(std::move(newGrid));
-    
-    std::cout << "Grille redimensionnee: " << newWidth << "x" << newHeight << std::endl;
+        
+        // Met à jour la grille initiale pour le reset
+        m_initialGrid = std::make_unique<Grid>(*newGrid);
+        
+        // Remplace la grille dans le jeu
+        game.reset(std::move(newGrid));
+        
+        std::cout << "Grille redimensionnee: " << newWidth << "x" << newHeight << std::endl;
+    });
 }
 
 void GUIController::increaseGridSize(int amount) {
-    resizeGrid(m_game.getGrid().getWidth() + amount, m_game.getGrid().getHeight() + amount);
+    const SimulationFrame& frame = m_simulation.getFrame();
+    resizeGrid(frame.width + amount, frame.height + amount);
 }
 
 void GUIController::decreaseGridSize(int amount) {
-    resizeGrid(m_game.getGrid().getWidth() - amount, m_game.getGrid().getHeight() - amount);
+    const SimulationFrame& frame = m_simulation.getFrame();
+    resizeGrid(frame.width - amount, frame.height - amount);
 }
@@ -1,6 +1,48 @@
 #include "gui/GUIRenderer.hpp"
 #include <sstream>
 #include <iomanip>
+#include <algorithm>
+
+namespace {
+
+/**
+ * @brief Appelle visit(x, y, largeur, hauteur) pour chaque plage contiguë de tuiles
+ *        modifiées d'une ligne de tuiles, limitée au rectangle [left, right[ x [top, bottom[
+ */
+template <typename Visit>
+void forEachDirtyRun(const SimulationFrame& frame, int left, int top, int right, int bottom, Visit visit) {
+    const int tile = SimulationFrame::TILE_SIZE;
+    for (int ty = top / tile; ty * tile < bottom; ++ty) {
+        const std::uint8_t* dirty = frame.dirtyTiles.data() + static_cast<size_t>(ty) * frame.tilesX;
+        int y = std::max(ty * tile, top);
+        int height = std::min((ty + 1) * tile, bottom) - y;
+        for (int tx = left / tile; tx * tile < right; ++tx) {
+            if (!dirty[tx]) continue;
+            int first = tx;
+            while ((tx + 1) * tile < right && dirty[tx + 1]) ++tx;
+            int x = std::max(first * tile, left);
+            visit(x, y, std::min((tx + 1) * tile, right) - x, height);
+        }
+    }
+}
+
+/**
+ * @brief Taille lisible d'une quantité de mémoire (Ko, Mo, Go)
+ */
+std::string formatBytes(size_t bytes) {
+    std::ostringstream out;
+    out << std::fixed << std::setprecision(1);
+    if (bytes >= (size_t(1) << 30)) {
+        out << bytes / double(size_t(1) << 30) << " Go";
+    } else if (bytes >= (size_t(1) << 20)) {
+        out << bytes / double(size_t(1) << 20) << " Mo";
+    } else {
+        out << bytes / 1024.0 << " Ko";
+    }
+    return out.str();
+}
+
+} // namespace
 
 GUIRenderer::GUIRenderer(sf::RenderWindow& window, int cellSize)
     : m_window(window)
@@ -15,6 +57,20 @@ GUIRenderer::GUIRenderer(sf::RenderWindow& window, int cellSize)
     , m_offsetX(200)   // Espace pour le panneau latéral
     , m_offsetY(50)    // Espace pour le panneau info
     , m_panelWidth(200)
+    , m_cameraX(0)
+    , m_cameraY(0)
+    , m_textureSequence(0)
+    , m_textureX(0)
+    , m_textureY(0)
+    , m_lodLevel(0)
+    , m_pyramidSequence(0)
+    , m_infoValues()
+    , m_infoValid(false)
+    , m_sidePanelToroidal(false)
+    , m_sidePanelParallel(false)
+    , m_sidePanelShowGrid(false)
+    , m_sidePanelValid(false)
+    , m_helpValid(false)
 {
     // Tente de charger une police système
     const std::vector<std::string> fontPaths = {
@@ -31,53 +87,232 @@ GUIRenderer::GUIRenderer(sf::RenderWindow& window, int cellSize)
             break;
         }
     }
+    
+    // Mise en forme fixe des textes du panneau d'information
+    m_infoBackground.setFillColor(sf::Color(30, 30, 30));
+    m_infoText.setFont(m_font);
+    m_infoText.setCharacterSize(13);
+    m_infoText.setPosition(m_offsetX + 10.f, 8.f);
+    m_optionsText.setFont(m_font);
+    m_optionsText.setCharacterSize(11);
+    m_optionsText.setFillColor(sf::Color(100, 180, 100));
+    m_optionsText.setPosition(m_offsetX + 10.f, 28.f);
+    m_quickHelpText.setFont(m_font);
+    m_quickHelpText.setString("[ESPACE] Play  [[] Taille  [H] Aide");
+    m_quickHelpText.setCharacterSize(10);
+    m_quickHelpText.setFillColor(sf::Color(120, 120, 120));
+    m_statusText.setFont(m_font);
+    m_statusText.setCharacterSize(10);
+    
+    m_perfBackground.setSize(sf::Vector2f(PERF_BOX_WIDTH, PERF_BOX_HEIGHT));
+    m_perfBackground.setFillColor(sf::Color(0, 0, 0, 190));
+    m_perfBackground.setOutlineColor(sf::Color(52, 73, 94));
+    m_perfBackground.setOutlineThickness(1.f);
+    m_perfText.setFont(m_font);
+    m_perfText.setCharacterSize(11);
+    m_perfText.setFillColor(sf::Color::White);
+    m_perfGraph.setPrimitiveType(sf::Quads);
 }
 
-void GUIRenderer::render(const Grid& grid) {
-    int gridWidth = grid.getWidth();
-    int gridHeight = grid.getHeight();
-    
-    // Dessine les cellules
-    sf::RectangleShape cell(sf::Vector2f(static_cast<float>(m_cellSize - 1), 
-                                         static_cast<float>(m_cellSize - 1)));
-    
-    for (int y = 0; y < gridHeight; ++y) {
-        for (int x = 0; x < gridWidth; ++x) {
-            const Cell& c = grid.getCell(x, y);
-            
-            // Détermine la couleur
-            sf::Color color;
-            if (c.isObstacle()) {
-                color = c.isAlive() ? m_obstacleAliveColor : m_obstacleDeadColor;
-            } else {
-                color = c.isAlive() ? m_aliveColor : m_deadColor;
-            }
-            
-            cell.setFillColor(color);
-            cell.setPosition(
-                static_cast<float>(m_offsetX + x * m_cellSize),
-                static_cast<float>(m_offsetY + y * m_cellSize)
-            );
-            m_window.draw(cell);
+void GUIRenderer::setStatus(const std::string& message, bool error) {
+    m_statusText.setString(message);
+    m_statusText.setFillColor(error ? sf::Color(231, 76, 60) : sf::Color(150, 150, 150));
+}
+
+void GUIRenderer::uploadRegion(const SimulationFrame& frame, int x, int y, int width, int height) {
+    // Couleur de chaque code de cellule (0 mort, 1 vivant, 2 obstacle mort, 3 obstacle vivant)
+    const sf::Color palette[4] = {m_deadColor, m_aliveColor, m_obstacleDeadColor, m_obstacleAliveColor};
+    
+    m_pixels.resize(static_cast<size_t>(width) * height * 4);
+    sf::Uint8* pixel = m_pixels.data();
+    for (int row = y; row < y + height; ++row) {
+        const std::uint8_t* code = frame.codes.data() + static_cast<size_t>(row) * frame.width + x;
+        for (int col = 0; col < width; ++col) {
+            const sf::Color& color = palette[code[col] & 3];
+            pixel[0] = color.r;
+            pixel[1] = color.g;
+            pixel[2] = color.b;
+            pixel[3] = color.a;
+            pixel += 4;
         }
     }
+    m_gridTexture.update(m_pixels.data(), static_cast<unsigned int>(width), static_cast<unsigned int>(height),
+                         static_cast<unsigned int>(x - m_textureX), static_cast<unsigned int>(y - m_textureY));
+}
+
+int GUIRenderer::pixelsToCells(int pixels) const {
+    return m_lodLevel > 0 ? pixels * (1 << m_lodLevel) : pixels / m_cellSize;
+}
+
+int GUIRenderer::getViewColumns() const {
+    return std::max(1, pixelsToCells(static_cast<int>(m_window.getSize().x) - m_offsetX));
+}
+
+int GUIRenderer::getViewRows() const {
+    return std::max(1, pixelsToCells(static_cast<int>(m_window.getSize().y) - m_offsetY));
+}
+
+void GUIRenderer::clampCamera(int gridWidth, int gridHeight) {
+    m_cameraX = std::max(0, std::min(m_cameraX, gridWidth - getViewColumns()));
+    m_cameraY = std::max(0, std::min(m_cameraY, gridHeight - getViewRows()));
+}
+
+void GUIRenderer::zoomAt(int screenX, int screenY, int cellSize, int lodLevel) {
+    // Cellule sous le point avant le zoom, puis caméra qui la garde au même endroit
+    int cellX = m_cameraX + pixelsToCells(screenX - m_offsetX);
+    int cellY = m_cameraY + pixelsToCells(screenY - m_offsetY);
+    m_cellSize = lodLevel > 0 ? 1 : cellSize;
+    m_lodLevel = std::max(0, std::min(lodLevel, MAX_LOD_LEVEL));
+    m_cameraX = cellX - pixelsToCells(screenX - m_offsetX);
+    m_cameraY = cellY - pixelsToCells(screenY - m_offsetY);
+}
+
+void GUIRenderer::updatePyramid(const SimulationFrame& frame) {
+    const bool sameSize = m_pyramid.getWidth() == frame.width && m_pyramid.getHeight() == frame.height;
+    if (sameSize && frame.sequence == m_pyramidSequence) return;
+    
+    if (sameSize && m_pyramidSequence != 0 && frame.baseSequence == m_pyramidSequence) {
+        // Seuls les blocs couvrant les tuiles modifiées sont recalculés
+        forEachDirtyRun(frame, 0, 0, frame.width, frame.height, [this, &frame](int x, int y, int width, int height) {
+            m_pyramid.update(frame.codes.data(), x, y, width, height);
+        });
+    } else {
+        m_pyramid.rebuild(frame.codes.data(), frame.width, frame.height);
+    }
+    m_pyramidSequence = frame.sequence;
+}
+
+void GUIRenderer::renderDensity(const SimulationFrame& frame) {
+    updatePyramid(frame);
+    
+    // Niveau limité à celui où la grille tient en un bloc
+    if (m_lodLevel > m_pyramid.getLevelCount()) {
+        m_lodLevel = m_pyramid.getLevelCount();
+        clampCamera(frame.width, frame.height);
+    }
+    const int level = m_lodLevel;
+    
+    // Un pixel par bloc de 2^level x 2^level cellules
+    const int blockX = m_cameraX >> level;
+    const int blockY = m_cameraY >> level;
+    const int columns = std::min(m_pyramid.getLevelWidth(level) - blockX,
+                                 static_cast<int>(m_window.getSize().x) - m_offsetX);
+    const int rows = std::min(m_pyramid.getLevelHeight(level) - blockY,
+                              static_cast<int>(m_window.getSize().y) - m_offsetY);
+    if (columns <= 0 || rows <= 0) return;
+    
+    sf::Vector2u textureSize = m_gridTexture.getSize();
+    if (textureSize.x != static_cast<unsigned int>(columns) ||
+        textureSize.y != static_cast<unsigned int>(rows)) {
+        if (!m_gridTexture.create(static_cast<unsigned int>(columns), static_cast<unsigned int>(rows))) {
+            return;
+        }
+        m_gridSprite.setTexture(m_gridTexture, true);
+    }
+    // La texture ne contient plus des cellules : le prochain rendu normal la renverra en entier
+    m_textureSequence = 0;
+    
+    // Dégradé de la couleur des cellules mortes à celle des vivantes selon la densité
+    sf::Color gradient[256];
+    for (int d = 0; d < 256; ++d) {
+        gradient[d] = sf::Color(
+            static_cast<sf::Uint8>(m_deadColor.r + (m_aliveColor.r - m_deadColor.r) * d / 255),
+            static_cast<sf::Uint8>(m_deadColor.g + (m_aliveColor.g - m_deadColor.g) * d / 255),
+            static_cast<sf::Uint8>(m_deadColor.b + (m_aliveColor.b - m_deadColor.b) * d / 255));
+    }
+    
+    m_pixels.resize(static_cast<size_t>(columns) * rows * 4);
+    sf::Uint8* pixel = m_pixels.data();
+    const int levelWidth = m_pyramid.getLevelWidth(level);
+    for (int row = 0; row < rows; ++row) {
+        const std::uint8_t* density = m_pyramid.getLevel(level) + static_cast<size_t>(blockY + row) * levelWidth + blockX;
+        for (int col = 0; col < columns; ++col) {
+            const sf::Color& color = gradient[density[col]];
+            pixel[0] = color.r;
+            pixel[1] = color.g;
+            pixel[2] = color.b;
+            pixel[3] = 255;
+            pixel += 4;
+        }
+    }
+    m_gridTexture.update(m_pixels.data());
+    
+    m_gridSprite.setPosition(static_cast<float>(m_offsetX), static_cast<float>(m_offsetY));
+    m_gridSprite.setScale(1.f, 1.f);
+    m_window.draw(m_gridSprite);
+}
+
+void GUIRenderer::render(const SimulationFrame& frame) {
+    const int gridWidth = frame.width;
+    const int gridHeight = frame.height;
+    clampCamera(gridWidth, gridHeight);
+    
+    // Plus de cellules que de pixels : densité par pixel tirée de la pyramide
+    if (m_lodLevel > 0) {
+        renderDensity(frame);
+        return;
+    }
+    
+    // Cellules visibles : la dernière colonne (ou ligne) peut n'être affichée qu'en partie
+    const int viewWidth = static_cast<int>(m_window.getSize().x) - m_offsetX;
+    const int viewHeight = static_cast<int>(m_window.getSize().y) - m_offsetY;
+    const int columns = std::min(gridWidth - m_cameraX, (viewWidth + m_cellSize - 1) / m_cellSize);
+    const int rows = std::min(gridHeight - m_cameraY, (viewHeight + m_cellSize - 1) / m_cellSize);
+    if (columns <= 0 || rows <= 0) return;
+    
+    sf::Vector2u textureSize = m_gridTexture.getSize();
+    if (textureSize.x != static_cast<unsigned int>(columns) ||
+        textureSize.y != static_cast<unsigned int>(rows)) {
+        if (!m_gridTexture.create(static_cast<unsigned int>(columns), static_cast<unsigned int>(rows))) {
+            return;
+        }
+        m_gridSprite.setTexture(m_gridTexture, true);
+        m_textureSequence = 0;
+    }
+    if (m_textureX != m_cameraX || m_textureY != m_cameraY) {
+        m_textureX = m_cameraX;
+        m_textureY = m_cameraY;
+        m_textureSequence = 0;
+    }
+    
+    if (frame.sequence != m_textureSequence) {
+        if (m_textureSequence != 0 && frame.baseSequence == m_textureSequence) {
+            // Seules les tuiles modifiées visibles sont renvoyées, par plages contiguës de chaque
+            // ligne de tuiles
+            forEachDirtyRun(frame, m_cameraX, m_cameraY, m_cameraX + columns, m_cameraY + rows,
+                            [this, &frame](int x, int y, int width, int height) {
+                uploadRegion(frame, x, y, width, height);
+            });
+        } else {
+            uploadRegion(frame, m_cameraX, m_cameraY, columns, rows);
+        }
+        m_textureSequence = frame.sequence;
+    }
+    
+    m_gridSprite.setPosition(static_cast<float>(m_offsetX), static_cast<float>(m_offsetY));
+    m_gridSprite.setScale(static_cast<float>(m_cellSize), static_cast<float>(m_cellSize));
+    m_window.draw(m_gridSprite);
     
-    // Dessine la grille si activée
+    // Dessine la grille si activée (partie visible uniquement)
     if (m_showGrid && m_cellSize > 4) {
         sf::VertexArray lines(sf::Lines);
+        const float left = static_cast<float>(m_offsetX);
+        const float top = static_cast<float>(m_offsetY);
+        const float right = static_cast<float>(m_offsetX + columns * m_cellSize);
+        const float bottom = static_cast<float>(m_offsetY + rows * m_cellSize);
         
         // Lignes verticales
-        for (int x = 0; x <= gridWidth; ++x) {
+        for (int x = 0; x <= columns; ++x) {
             float xPos = static_cast<float>(m_offsetX + x * m_cellSize);
-            lines.append(sf::Vertex(sf::Vector2f(xPos, static_cast<float>(m_offsetY)), m_gridColor));
-            lines.append(sf::Vertex(sf::Vector2f(xPos, static_cast<float>(m_offsetY + gridHeight * m_cellSize)), m_gridColor));
+            lines.append(sf::Vertex(sf::Vector2f(xPos, top), m_gridColor));
+            lines.append(sf::Vertex(sf::Vector2f(xPos, bottom), m_gridColor));
         }
         
         // Lignes horizontales
-        for (int y = 0; y <= gridHeight; ++y) {
+        for (int y = 0; y <= rows; ++y) {
             float yPos = static_cast<float>(m_offsetY + y * m_cellSize);
-            lines.append(sf::Vertex(sf::Vector2f(static_cast<float>(m_offsetX), yPos), m_gridColor));
-            lines.append(sf::Vertex(sf::Vector2f(static_cast<float>(m_offsetX + gridWidth * m_cellSize), yPos), m_gridColor));
+            lines.append(sf::Vertex(sf::Vector2f(left, yPos), m_gridColor));
+            lines.append(sf::Vertex(sf::Vector2f(right, yPos), m_gridColor));
         }
         
         m_window.draw(lines);
@@ -85,61 +320,78 @@ void GUIRenderer::render(const Grid& grid) {
 }
 
 void GUIRenderer::renderInfoPanel(int iteration, bool running, int speed, bool toroidal, bool parallel,
-                                   int aliveCells, bool stable, int gridWidth, int gridHeight) {
+                                   int aliveCells, bool stable, int gridWidth, int gridHeight,
+                                   bool turbo, int turboRate, int generationsPerSecond) {
     // Fond du panneau supérieur
-    sf::RectangleShape panel(sf::Vector2f(static_cast<float>(m_window.getSize().x), 
+    m_infoBackground.setSize(sf::Vector2f(static_cast<float>(m_window.getSize().x), 
                                           static_cast<float>(m_offsetY)));
-    panel.setFillColor(sf::Color(30, 30, 30));
-    m_window.draw(panel);
+    m_window.draw(m_infoBackground);
     
     if (!m_fontLoaded) return;
     
-    // Texte d'information
-    std::ostringstream info;
-    info << "Gen: " << iteration;
-    info << "  |  Vivantes: " << aliveCells;
-    info << "  |  Grille: " << gridWidth << "x" << gridHeight;
-    info << "  |  " << (running ? "EN COURS" : "PAUSE");
-    if (stable && iteration > 0) info << "  |  STABLE";
-    
-    sf::Text text;
-    text.setFont(m_font);
-    text.setString(info.str());
-    text.setCharacterSize(13);
-    text.setFillColor(running ? sf::Color(46, 204, 113) : sf::Color::White);
-    text.setPosition(m_offsetX + 10.f, 8.f);
-    m_window.draw(text);
-    
-    // Indicateurs d'options
-    std::ostringstream opts;
-    if (toroidal) opts << "[Torique] ";
-    if (parallel) opts << "[Parallele] ";
-    opts << "Vitesse: " << speed << "ms  |  Zoom: " << m_cellSize << "px";
-    
-    sf::Text optsText;
-    optsText.setFont(m_font);
-    optsText.setString(opts.str());
-    optsText.setCharacterSize(11);
-    optsText.setFillColor(sf::Color(100, 180, 100));
-    optsText.setPosition(m_offsetX + 10.f, 28.f);
-    m_window.draw(optsText);
+    // Textes recomposés seulement si une valeur affichée a changé
+    const bool showCamera = gridWidth > getViewColumns() || gridHeight > getViewRows();
+    const InfoValues values = {iteration, running, speed, toroidal, parallel, aliveCells, stable && iteration > 0,
+                               gridWidth, gridHeight, showCamera ? m_cameraX : -1, showCamera ? m_cameraY : -1,
+                               m_cellSize, m_lodLevel, turbo, turboRate, running ? generationsPerSecond : 0};
+    if (!m_infoValid || !(values == m_infoValues)) {
+        // Texte d'information
+        std::ostringstream info;
+        info << "Gen: " << iteration;
+        info << "  |  Vivantes: " << aliveCells;
+        info << "  |  Grille: " << gridWidth << "x" << gridHeight;
+        if (showCamera) {
+            info << "  |  Vue: " << m_cameraX << "," << m_cameraY;
+        }
+        info << "  |  " << (running ? "EN COURS" : "PAUSE");
+        if (running) info << "  |  " << generationsPerSecond << " gen/s";
+        if (stable && iteration > 0) info << "  |  STABLE";
+        m_infoText.setString(info.str());
+        m_infoText.setFillColor(running ? sf::Color(46, 204, 113) : sf::Color::White);
+        
+        // Indicateurs d'options
+        std::ostringstream opts;
+        if (toroidal) opts << "[Torique] ";
+        if (parallel) opts << "[Parallele] ";
+        if (turbo) {
+            opts << "[Turbo] Cible: ";
+            if (turboRate > 0) {
+                opts << turboRate << " gen/s";
+            } else {
+                opts << "max";
+            }
+        } else {
+            opts << "Vitesse: " << speed << "ms";
+        }
+        opts << "  |  Zoom: ";
+        if (m_lodLevel > 0) {
+            opts << "1px = " << (1 << m_lodLevel) << "x" << (1 << m_lodLevel) << " cellules (densite)";
+        } else {
+            opts << m_cellSize << "px";
+        }
+        m_optionsText.setString(opts.str());
+        
+        m_infoValues = values;
+        m_infoValid = true;
+    }
+    m_window.draw(m_infoText);
+    m_window.draw(m_optionsText);
     
     // Instructions rapides
-    sf::Text quickHelp;
-    quickHelp.setFont(m_font);
-    quickHelp.setString("[ESPACE] Play  [[] Taille  [H] Aide");
-    quickHelp.setCharacterSize(10);
-    quickHelp.setFillColor(sf::Color(120, 120, 120));
-    quickHelp.setPosition(static_cast<float>(m_window.getSize().x - 220), 18.f);
-    m_window.draw(quickHelp);
+    m_quickHelpText.setPosition(static_cast<float>(m_window.getSize().x - 220), 10.f);
+    m_window.draw(m_quickHelpText);
+    
+    // Message d'état (sauvegarde en cours, terminée ou en erreur)
+    m_statusText.setPosition(static_cast<float>(m_window.getSize().x - 220), 28.f);
+    m_window.draw(m_statusText);
 }
 
-void GUIRenderer::renderSidePanel(const std::string& selectedPattern, bool toroidal, bool parallel) {
+void GUIRenderer::drawSidePanel(sf::RenderTarget& target, const std::string& selectedPattern, bool toroidal,
+                                bool parallel, float height) {
     // Fond du panneau latéral
-    sf::RectangleShape panel(sf::Vector2f(static_cast<float>(m_panelWidth), 
-                                          static_cast<float>(m_window.getSize().y)));
+    sf::RectangleShape panel(sf::Vector2f(static_cast<float>(m_panelWidth), height));
     panel.setFillColor(sf::Color(25, 25, 35));
-    m_window.draw(panel);
+    target.draw(panel);
     
     if (!m_fontLoaded) return;
     
@@ -154,7 +406,7 @@ void GUIRenderer::renderSidePanel(const std::string& selectedPattern, bool toroi
     title.setFillColor(sf::Color(46, 204, 113));
     title.setStyle(sf::Text::Bold);
     title.setPosition(xMargin, yPos);
-    m_window.draw(title);
+    target.draw(title);
     yPos += 35.f;
     
     // Section Contrôles
@@ -164,7 +416,7 @@ void GUIRenderer::renderSidePanel(const std::string& selectedPattern, bool toroi
     sectionCtrl.setCharacterSize(12);
     sectionCtrl.setFillColor(sf::Color(100, 100, 100));
     sectionCtrl.setPosition(xMargin, yPos);
-    m_window.draw(sectionCtrl);
+    target.draw(sectionCtrl);
     yPos += 20.f;
     
     // Boutons de contrôle (représentation visuelle)
@@ -174,6 +426,7 @@ void GUIRenderer::renderSidePanel(const std::string& selectedPattern, bool toroi
         {"[C]", "Effacer grille"},
         {"[R]", "Reinitialiser"},
         {"[+/-]", "Vitesse"},
+        {"[F]", "Turbo"},
     };
     
     for (const auto& ctrl : controls) {
@@ -183,7 +436,7 @@ void GUIRenderer::renderSidePanel(const std::string& selectedPattern, bool toroi
         keyText.setCharacterSize(11);
         keyText.setFillColor(sf::Color(150, 200, 150));
         keyText.setPosition(xMargin, yPos);
-        m_window.draw(keyText);
+        target.draw(keyText);
         
         sf::Text descText;
         descText.setFont(m_font);
@@ -191,7 +444,7 @@ void GUIRenderer::renderSidePanel(const std::string& selectedPattern, bool toroi
         descText.setCharacterSize(11);
         descText.setFillColor(sf::Color(180, 180, 180));
         descText.setPosition(xMargin + 60.f, yPos);
-        m_window.draw(descText);
+        target.draw(descText);
         yPos += 18.f;
     }
     
@@ -204,7 +457,7 @@ void GUIRenderer::renderSidePanel(const std::string& selectedPattern, bool toroi
     sectionOpt.setCharacterSize(12);
     sectionOpt.setFillColor(sf::Color(100, 100, 100));
     sectionOpt.setPosition(xMargin, yPos);
-    m_window.draw(sectionOpt);
+    target.draw(sectionOpt);
     yPos += 20.f;
     
     // Option Torique
@@ -213,7 +466,7 @@ void GUIRenderer::renderSidePanel(const std::string& selectedPattern, bool toroi
     toggleBg.setFillColor(toroidal ? sf::Color(46, 204, 113) : sf::Color(60, 60, 60));
     toggleBg.setOutlineColor(sf::Color(100, 100, 100));
     toggleBg.setOutlineThickness(1.f);
-    m_window.draw(toggleBg);
+    target.draw(toggleBg);
     
     sf::Text toroidalText;
     toroidalText.setFont(m_font);
@@ -221,7 +474,7 @@ void GUIRenderer::renderSidePanel(const std::string& selectedPattern, bool toroi
     toroidalText.setCharacterSize(11);
     toroidalText.setFillColor(sf::Color(180, 180, 180));
     toroidalText.setPosition(xMargin + 22.f, yPos);
-    m_window.draw(toroidalText);
+    target.draw(toroidalText);
     yPos += 22.f;
     
     // Option Parallèle
@@ -230,7 +483,7 @@ void GUIRenderer::renderSidePanel(const std::string& selectedPattern, bool toroi
     toggleBg2.setFillColor(parallel ? sf::Color(46, 204, 113) : sf::Color(60, 60, 60));
     toggleBg2.setOutlineColor(sf::Color(100, 100, 100));
     toggleBg2.setOutlineThickness(1.f);
-    m_window.draw(toggleBg2);
+    target.draw(toggleBg2);
     
     sf::Text parallelText;
     parallelText.setFont(m_font);
@@ -238,7 +491,7 @@ void GUIRenderer::renderSidePanel(const std::string& selectedPattern, bool toroi
     parallelText.setCharacterSize(11);
     parallelText.setFillColor(sf::Color(180, 180, 180));
     parallelText.setPosition(xMargin + 22.f, yPos);
-    m_window.draw(parallelText);
+    target.draw(parallelText);
     yPos += 22.f;
     
     // Option Grille
@@ -247,7 +500,7 @@ void GUIRenderer::renderSidePanel(const std::string& selectedPattern, bool toroi
     toggleBg3.setFillColor(m_showGrid ? sf::Color(46, 204, 113) : sf::Color(60, 60, 60));
     toggleBg3.setOutlineColor(sf::Color(100, 100, 100));
     toggleBg3.setOutlineThickness(1.f);
-    m_window.draw(toggleBg3);
+    target.draw(toggleBg3);
     
     sf::Text gridText;
     gridText.setFont(m_font);
@@ -255,7 +508,7 @@ void GUIRenderer::renderSidePanel(const std::string& selectedPattern, bool toroi
     gridText.setCharacterSize(11);
     gridText.setFillColor(sf::Color(180, 180, 180));
     gridText.setPosition(xMargin + 22.f, yPos);
-    m_window.draw(gridText);
+    target.draw(gridText);
     yPos += 30.f;
     
     // Section Patterns
@@ -265,7 +518,7 @@ void GUIRenderer::renderSidePanel(const std::string& selectedPattern, bool toroi
     sectionPat.setCharacterSize(12);
     sectionPat.setFillColor(sf::Color(100, 100, 100));
     sectionPat.setPosition(xMargin, yPos);
-    m_window.draw(sectionPat);
+    target.draw(sectionPat);
     yPos += 20.f;
     
     std::vector<std::pair<std::string, std::string>> patterns = {
@@ -298,7 +551,7 @@ void GUIRenderer::renderSidePanel(const std::string& selectedPattern, bool toroi
         numText.setCharacterSize(11);
         numText.setFillColor(isSelected ? sf::Color(46, 204, 113) : sf::Color(100, 150, 100));
         numText.setPosition(xMargin, yPos);
-        m_window.draw(numText);
+        target.draw(numText);
         
         sf::Text patText;
         patText.setFont(m_font);
@@ -307,7 +560,7 @@ void GUIRenderer::renderSidePanel(const std::string& selectedPattern, bool toroi
         patText.setFillColor(isSelected ? sf::Color::White : sf::Color(150, 150, 150));
         if (isSelected) patText.setStyle(sf::Text::Bold);
         patText.setPosition(xMargin + 30.f, yPos);
-        m_window.draw(patText);
+        target.draw(patText);
         yPos += 18.f;
     }
     
@@ -320,17 +573,17 @@ void GUIRenderer::renderSidePanel(const std::string& selectedPattern, bool toroi
     mouseTitle.setCharacterSize(12);
     mouseTitle.setFillColor(sf::Color(100, 100, 100));
     mouseTitle.setPosition(xMargin, yPos);
-    m_window.draw(mouseTitle);
+    target.draw(mouseTitle);
     yPos += 20.f;
     
     sf::Text mouseInfo;
     mouseInfo.setFont(m_font);
-    mouseInfo.setString("Clic G: Placer pattern\nShift+Clic: 1 cellule\nCtrl+Clic: Obstacle\nClic D: Supprimer\nMolette: Zoom");
+    mouseInfo.setString("Clic G: Placer pattern\nShift+Clic: 1 cellule\nCtrl+Clic: Obstacle\nClic D: Supprimer\nMolette: Zoom\nClic milieu: Deplacer");
     mouseInfo.setCharacterSize(10);
     mouseInfo.setFillColor(sf::Color(150, 150, 150));
     mouseInfo.setPosition(xMargin, yPos);
-    m_window.draw(mouseInfo);
-    yPos += 70.f;
+    target.draw(mouseInfo);
+    yPos += 84.f;
     
     // Section Grille
     sf::Text gridSection;
@@ -339,7 +592,7 @@ void GUIRenderer::renderSidePanel(const std::string& selectedPattern, bool toroi
     gridSection.setCharacterSize(12);
     gridSection.setFillColor(sf::Color(100, 100, 100));
     gridSection.setPosition(xMargin, yPos);
-    m_window.draw(gridSection);
+    target.draw(gridSection);
     yPos += 20.f;
     
     sf::Text gridInfo;
@@ -348,7 +601,7 @@ void GUIRenderer::renderSidePanel(const std::string& selectedPattern, bool toroi
     gridInfo.setCharacterSize(10);
     gridInfo.setFillColor(sf::Color(150, 150, 150));
     gridInfo.setPosition(xMargin, yPos);
-    m_window.draw(gridInfo);
+    target.draw(gridInfo);
     yPos += 35.f;
     
     // Section Fichier
@@ -358,7 +611,7 @@ void GUIRenderer::renderSidePanel(const std::string& selectedPattern, bool toroi
     fileSection.setCharacterSize(12);
     fileSection.setFillColor(sf::Color(100, 100, 100));
     fileSection.setPosition(xMargin, yPos);
-    m_window.draw(fileSection);
+    target.draw(fileSection);
     yPos += 20.f;
     
     sf::Text saveInfo;
@@ -367,27 +620,47 @@ void GUIRenderer::renderSidePanel(const std::string& selectedPattern, bool toroi
     saveInfo.setCharacterSize(11);
     saveInfo.setFillColor(sf::Color(150, 150, 150));
     saveInfo.setPosition(xMargin, yPos);
-    m_window.draw(saveInfo);
+    target.draw(saveInfo);
 }
 
-void GUIRenderer::renderHelp() {
-    if (!m_fontLoaded) return;
-    
-    // Fond semi-transparent
-    sf::RectangleShape overlay(sf::Vector2f(static_cast<float>(m_window.getSize().x), 
-                                            static_cast<float>(m_window.getSize().y)));
-    overlay.setFillColor(sf::Color(0, 0, 0, 220));
-    m_window.draw(overlay);
-    
-    // Cadre central
-    float boxWidth = 500.f;
-    float boxHeight = 450.f;
-    sf::RectangleShape box(sf::Vector2f(boxWidth, boxHeight));
-    box.setPosition((m_window.getSize().x - boxWidth) / 2.f, (m_window.getSize().y - boxHeight) / 2.f);
+void GUIRenderer::renderSidePanel(const std::string& selectedPattern, bool toroidal, bool parallel) {
+    const unsigned int height = m_window.getSize().y;
+    
+    // Le panneau n'est redessiné que lorsque son contenu change
+    const bool stale = !m_sidePanelValid || m_sidePanelPattern != selectedPattern ||
+                       m_sidePanelToroidal != toroidal || m_sidePanelParallel != parallel ||
+                       m_sidePanelShowGrid != m_showGrid || m_sidePanelCache.getSize().y != height;
+    if (stale) {
+        if (m_sidePanelCache.getSize().x != static_cast<unsigned int>(m_panelWidth) ||
+            m_sidePanelCache.getSize().y != height) {
+            if (!m_sidePanelCache.create(static_cast<unsigned int>(m_panelWidth), height)) {
+                // Pas de rendu hors écran : dessin direct
+                drawSidePanel(m_window, selectedPattern, toroidal, parallel, static_cast<float>(height));
+                return;
+            }
+        }
+        m_sidePanelCache.clear(sf::Color::Transparent);
+        drawSidePanel(m_sidePanelCache, selectedPattern, toroidal, parallel, static_cast<float>(height));
+        m_sidePanelCache.display();
+        m_sidePanelSprite.setTexture(m_sidePanelCache.getTexture(), true);
+        
+        m_sidePanelPattern = selectedPattern;
+        m_sidePanelToroidal = toroidal;
+        m_sidePanelParallel = parallel;
+        m_sidePanelShowGrid = m_showGrid;
+        m_sidePanelValid = true;
+    }
+    m_window.draw(m_sidePanelSprite);
+}
+
+void GUIRenderer::drawHelpBox(sf::RenderTarget& target, float x, float y) {
+    // Cadre
+    sf::RectangleShape box(sf::Vector2f(HELP_BOX_WIDTH, HELP_BOX_HEIGHT));
+    box.setPosition(x, y);
     box.setFillColor(sf::Color(35, 35, 45));
     box.setOutlineColor(sf::Color(46, 204, 113));
     box.setOutlineThickness(2.f);
-    m_window.draw(box);
+    target.draw(box);
     
     // Texte d'aide
     std::string helpText = 
@@ -403,13 +676,17 @@ void GUIRenderer::renderHelp() {
         "  C           Effacer la grille\n"
         "  R           Reinitialiser\n"
         "  +/-         Ajuster vitesse\n"
+        "  F           Mode turbo ON/OFF\n"
         "  G           Afficher/Masquer grille\n"
         "  T           Mode torique ON/OFF\n"
         "  P           Calcul parallele ON/OFF\n"
         "  [ ]         Reduire/Agrandir grille\n"
         "  Ctrl+Fleches  Taille largeur/hauteur\n"
+        "  Shift+Fleches Deplacer la vue\n"
+        "  Origine     Revenir au coin de la grille\n"
         "  1-9         Selectionner pattern\n"
         "  F5          Sauvegarder etat\n"
+        "  F3          Panneau de performances\n"
         "  H           Cette aide\n"
         "  ESC         Quitter\n\n"
         "SOURIS:\n"
@@ -417,7 +694,8 @@ void GUIRenderer::renderHelp() {
         "  Shift+Clic     Activer 1 cellule\n"
         "  Ctrl+Clic      Creer obstacle\n"
         "  Clic droit     Supprimer cellule\n"
-        "  Molette        Zoom +/-\n\n"
+        "  Molette        Zoom +/-\n"
+        "  Clic milieu    Deplacer la vue (glisser)\n\n"
         "Appuyez sur H pour fermer";
     
     sf::Text text;
@@ -425,18 +703,112 @@ void GUIRenderer::renderHelp() {
     text.setString(helpText);
     text.setCharacterSize(14);
     text.setFillColor(sf::Color::White);
-    text.setPosition((m_window.getSize().x - boxWidth) / 2.f + 30.f, 
-                     (m_window.getSize().y - boxHeight) / 2.f + 20.f);
-    m_window.draw(text);
+    text.setPosition(x + 30.f, y + 20.f);
+    target.draw(text);
+}
+
+void GUIRenderer::renderPerfOverlay(const PerfStats& stats) {
+    const float x = m_offsetX + 10.f;
+    const float y = m_offsetY + 10.f;
+    m_perfBackground.setPosition(x, y);
+    m_window.draw(m_perfBackground);
+    
+    const FrameHistory* history = stats.frameTimes;
+    if (m_fontLoaded) {
+        std::ostringstream text;
+        text << std::fixed << std::setprecision(2);
+        text << "PERFORMANCES  [F3]\n";
+        text << "Evenements:   " << stats.eventsMs << " ms\n";
+        text << "Mise a jour:  " << stats.updateMs << " ms\n";
+        text << "Rendu:        " << stats.renderMs << " ms\n";
+        text << "Generation:   " << stats.stepMs << " ms\n";
+        text << std::setprecision(0);
+        text << stats.generationsPerSecond << " gen/s  |  " << stats.framesPerSecond << " img/s\n";
+        text << std::setprecision(1);
+        if (history && history->getCount() > 0) {
+            text << "Image: min " << history->getMin() << "  moy " << history->getAverage()
+                 << "  max " << history->getMax() << " ms\n";
+        } else {
+            text << "Image: -\n";
+        }
+        text << "Memoire: grille " << formatBytes(stats.gridBytes)
+             << "  |  affichage " << formatBytes(memoryBytes());
+        m_perfText.setString(text.str());
+        m_perfText.setPosition(x + 10.f, y + 8.f);
+        m_window.draw(m_perfText);
+    }
+    
+    if (!history || history->getCount() == 0) return;
+    
+    // Graphe des dernières durées d'image, échelle d'au moins deux images à 60 img/s
+    const float graphX = x + 10.f;
+    const float graphBottom = y + PERF_BOX_HEIGHT - 10.f;
+    const float graphWidth = PERF_BOX_WIDTH - 20.f;
+    const float scale = std::max(history->getMax(), 1000.f / 30.f);
+    const float barWidth = graphWidth / history->getCapacity();
+    
+    m_perfGraph.resize((history->getCount() + 1) * 4);
+    for (size_t i = 0; i < history->getCount(); ++i) {
+        const float value = history->getSample(i);
+        const float height = std::max(1.f, PERF_GRAPH_HEIGHT * value / scale);
+        const sf::Color color = value <= 1000.f / 60.f ? sf::Color(46, 204, 113)
+                              : value <= 1000.f / 30.f ? sf::Color(230, 126, 34)
+                              : sf::Color(231, 76, 60);
+        const float left = graphX + i * barWidth;
+        sf::Vertex* quad = &m_perfGraph[i * 4];
+        quad[0] = sf::Vertex(sf::Vector2f(left, graphBottom - height), color);
+        quad[1] = sf::Vertex(sf::Vector2f(left + barWidth, graphBottom - height), color);
+        quad[2] = sf::Vertex(sf::Vector2f(left + barWidth, graphBottom), color);
+        quad[3] = sf::Vertex(sf::Vector2f(left, graphBottom), color);
+    }
+    
+    // Repère des 16,7 ms (60 img/s)
+    const float target = graphBottom - PERF_GRAPH_HEIGHT * (1000.f / 60.f) / scale;
+    const sf::Color lineColor(255, 255, 255, 120);
+    sf::Vertex* line = &m_perfGraph[history->getCount() * 4];
+    line[0] = sf::Vertex(sf::Vector2f(graphX, target), lineColor);
+    line[1] = sf::Vertex(sf::Vector2f(graphX + graphWidth, target), lineColor);
+    line[2] = sf::Vertex(sf::Vector2f(graphX + graphWidth, target + 1.f), lineColor);
+    line[3] = sf::Vertex(sf::Vector2f(graphX, target + 1.f), lineColor);
+    m_window.draw(m_perfGraph);
+}
+
+void GUIRenderer::renderHelp() {
+    if (!m_fontLoaded) return;
+    
+    // Fond semi-transparent
+    sf::RectangleShape overlay(sf::Vector2f(static_cast<float>(m_window.getSize().x), 
+                                            static_cast<float>(m_window.getSize().y)));
+    overlay.setFillColor(sf::Color(0, 0, 0, 220));
+    m_window.draw(overlay);
+    
+    // Cadre central, dessiné une seule fois (marge pour le contour)
+    const float margin = 2.f;
+    const float x = (m_window.getSize().x - HELP_BOX_WIDTH) / 2.f;
+    const float y = (m_window.getSize().y - HELP_BOX_HEIGHT) / 2.f;
+    if (!m_helpValid) {
+        if (!m_helpCache.create(static_cast<unsigned int>(HELP_BOX_WIDTH + 2 * margin),
+                                static_cast<unsigned int>(HELP_BOX_HEIGHT + 2 * margin))) {
+            drawHelpBox(m_window, x, y);
+            return;
+        }
+        m_helpCache.clear(sf::Color::Transparent);
+        drawHelpBox(m_helpCache, margin, margin);
+        m_helpCache.display();
+        m_helpSprite.setTexture(m_helpCache.getTexture(), true);
+        m_helpValid = true;
+    }
+    m_helpSprite.setPosition(x - margin, y - margin);
+    m_window.draw(m_helpSprite);
 }
 
-bool GUIRenderer::screenToGrid(int screenX, int screenY, int& gridX, int& gridY, const Grid& grid) const {
+bool GUIRenderer::screenToGrid(int screenX, int screenY, int& gridX, int& gridY, int gridWidth, int gridHeight) const {
     if (screenY < m_offsetY || screenX < m_offsetX) return false;
     
-    gridX = (screenX - m_offsetX) / m_cellSize;
-    gridY = (screenY - m_offsetY) / m_cellSize;
+    gridX = m_cameraX + pixelsToCells(screenX - m_offsetX);
+    gridY = m_cameraY + pixelsToCells(screenY - m_offsetY);
     
-    return gridX >= 0 && gridX < grid.getWidth() && gridY >= 0 && gridY < grid.getHeight();
+    return gridX >= 0 && gridX < gridWidth && gridY >= 0 && gridY < gridHeight;
 }
 
 int GUIRenderer::getSidePanelButtonAt(int screenX, int screenY) const {
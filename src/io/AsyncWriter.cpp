@@ -0,0 +1,72 @@
+#include "io/AsyncWriter.hpp"
+#include <exception>
+
+AsyncWriter::AsyncWriter()
+    : m_pending(0)
+    , m_stopping(false)
+{
+    m_thread = std::thread(&AsyncWriter::run, this);
+}
+
+AsyncWriter::~AsyncWriter() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_wakeUp.notify_one();
+    m_thread.join();
+}
+
+void AsyncWriter::run() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    for (;;) {
+        m_wakeUp.wait(lock, [this]() { return m_stopping || !m_jobs.empty(); });
+        if (m_jobs.empty()) {
+            // Arrêt demandé et plus rien à écrire
+            return;
+        }
+
+        Job job = std::move(m_jobs.front());
+        m_jobs.pop_front();
+        lock.unlock();
+
+        std::string error;
+        try {
+            job();
+        } catch (const std::exception& e) {
+            error = e.what();
+        } catch (...) {
+            error = "Unknown write error";
+        }
+
+        lock.lock();
+        if (!error.empty()) m_error = error;
+        if (--m_pending == 0) m_idle.notify_all();
+    }
+}
+
+void AsyncWriter::submit(Job job) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_jobs.push_back(std::move(job));
+        ++m_pending;
+    }
+    m_wakeUp.notify_one();
+}
+
+size_t AsyncWriter::pending() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_pending;
+}
+
+void AsyncWriter::flush() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_idle.wait(lock, [this]() { return m_pending == 0; });
+}
+
+std::string AsyncWriter::takeError() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::string error;
+    error.swap(m_error);
+    return error;
+}
@@ -0,0 +1,183 @@
+#include "io/Checkpoint.hpp"
+#include "io/BinaryIO.hpp"
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+#include <stdexcept>
+#include <cstring>
+#include <cctype>
+
+namespace fs = std::filesystem;
+using namespace BinaryIO;
+
+namespace {
+
+const char CHECKPOINT_MAGIC[8] = {'G', 'O', 'L', 'C', 'K', 'P', 'T', '1'};
+const std::uint32_t CHECKPOINT_VERSION = 1;
+const char* CHECKPOINT_PREFIX = "checkpoint_";
+const char* CHECKPOINT_EXTENSION = ".ckpt";
+
+/**
+ * @brief Compacte des codes sur 2 bits (4 cellules par octet)
+ */
+void packCodes(std::vector<std::uint8_t>& out, const std::vector<std::uint8_t>& codes) {
+    size_t start = out.size();
+    out.resize(start + (codes.size() + 3) / 4, 0);
+    for (size_t i = 0; i < codes.size(); ++i) {
+        out[start + i / 4] |= static_cast<std::uint8_t>((codes[i] & 3) << (2 * (i % 4)));
+    }
+}
+
+void unpackCodes(const std::uint8_t* data, size_t count, std::vector<std::uint8_t>& codes) {
+    codes.resize(count);
+    for (size_t i = 0; i < count; ++i) {
+        codes[i] = static_cast<std::uint8_t>((data[i / 4] >> (2 * (i % 4))) & 3);
+    }
+}
+
+/**
+ * @brief Liste les points de contrôle d'un dossier, du plus récent au plus ancien
+ */
+std::vector<std::pair<int, std::string>> listCheckpoints(const std::string& directory) {
+    std::vector<std::pair<int, std::string>> result;
+    std::error_code ec;
+    if (!fs::is_directory(directory, ec)) return result;
+
+    const std::string prefix = CHECKPOINT_PREFIX;
+    const std::string extension = CHECKPOINT_EXTENSION;
+    for (const auto& entry : fs::directory_iterator(directory, ec)) {
+        std::string name = entry.path().filename().string();
+        if (name.size() <= prefix.size() + extension.size() ||
+            name.compare(0, prefix.size(), prefix) != 0 ||
+            name.compare(name.size() - extension.size(), extension.size(), extension) != 0) {
+            continue;
+        }
+        std::string number = name.substr(prefix.size(), name.size() - prefix.size() - extension.size());
+        if (number.empty() || !std::all_of(number.begin(), number.end(),
+                                              [](unsigned char c) { return std::isdigit(c) != 0; })) continue;
+        result.emplace_back(std::stoi(number), entry.path().string());
+    }
+
+    std::sort(result.begin(), result.end(),
+              [](const auto& a, const auto& b) { return a.first > b.first; });
+    return result;
+}
+
+} // namespace
+
+CheckpointData Checkpoint::capture(const Game& game) {
+    CheckpointData data;
+    data.width = game.getGrid().getWidth();
+    data.height = game.getGrid().getHeight();
+    data.toroidal = game.getGrid().isToroidal();
+    data.ruleName = game.getRule().getName();
+    data.iteration = game.getIteration();
+    data.cells = game.getGrid().toCodes();
+    data.previousCells = game.getPreviousGrid().toCodes();
+    return data;
+}
+
+void Checkpoint::restore(const CheckpointData& data, Game& game) {
+    if (data.ruleName != game.getRule().getName()) {
+        throw std::runtime_error("Checkpoint rule mismatch: " + data.ruleName);
+    }
+
+    auto grid = std::make_unique<Grid>(data.width, data.height, data.cells, data.toroidal);
+    Grid previous(data.width, data.height, data.previousCells, data.toroidal);
+    game.restore(std::move(grid), previous, data.iteration);
+}
+
+void Checkpoint::write(const CheckpointData& data, const std::string& filepath) {
+    std::vector<std::uint8_t> buffer(CHECKPOINT_MAGIC, CHECKPOINT_MAGIC + 8);
+    putU32(buffer, CHECKPOINT_VERSION);
+    putU32(buffer, static_cast<std::uint32_t>(data.width));
+    putU32(buffer, static_cast<std::uint32_t>(data.height));
+    buffer.push_back(data.toroidal ? 1 : 0);
+    putU32(buffer, static_cast<std::uint32_t>(data.iteration));
+    putU32(buffer, static_cast<std::uint32_t>(data.ruleName.size()));
+    buffer.insert(buffer.end(), data.ruleName.begin(), data.ruleName.end());
+    packCodes(buffer, data.cells);
+    packCodes(buffer, data.previousCells);
+    putU64(buffer, fnv1a(buffer.data() + 8, buffer.size() - 8));
+
+    // Écriture dans un fichier temporaire puis renommage atomique
+    std::string tempPath = filepath + ".tmp";
+    {
+        std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+        if (!file.is_open()) {
+            throw std::runtime_error("Cannot create file: " + tempPath);
+        }
+        file.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+        file.flush();
+        if (!file) {
+            throw std::runtime_error("Cannot write to file: " + tempPath);
+        }
+    }
+    fs::rename(tempPath, filepath);
+}
+
+CheckpointData Checkpoint::read(const std::string& filepath) {
+    std::ifstream file(filepath, std::ios::binary);
+    if (!file.is_open()) {
+        throw std::runtime_error("Cannot open file: " + filepath);
+    }
+    std::vector<std::uint8_t> buffer((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+    const size_t fixedSize = 8 + 4 + 4 + 4 + 1 + 4 + 4;
+    if (buffer.size() < fixedSize + 8 || std::memcmp(buffer.data(), CHECKPOINT_MAGIC, 8) != 0) {
+        throw std::runtime_error("Invalid checkpoint format: " + filepath);
+    }
+    if (getU64(buffer.data() + buffer.size() - 8) != fnv1a(buffer.data() + 8, buffer.size() - 16)) {
+        throw std::runtime_error("Corrupted checkpoint: " + filepath);
+    }
+    if (getU32(buffer.data() + 8) != CHECKPOINT_VERSION) {
+        throw std::runtime_error("Unsupported checkpoint version: " + filepath);
+    }
+
+    CheckpointData data;
+    data.width = static_cast<int>(getU32(buffer.data() + 12));
+    data.height = static_cast<int>(getU32(buffer.data() + 16));
+    data.toroidal = buffer[20] != 0;
+    data.iteration = static_cast<int>(getU32(buffer.data() + 21));
+    size_t nameSize = getU32(buffer.data() + 25);
+
+    size_t cellCount = static_cast<size_t>(data.width) * data.height;
+    size_t packedSize = (cellCount + 3) / 4;
+    if (data.width <= 0 || data.height <= 0 || buffer.size() != fixedSize + nameSize + 2 * packedSize + 8) {
+        throw std::runtime_error("Invalid checkpoint format: " + filepath);
+    }
+
+    const std::uint8_t* pos = buffer.data() + fixedSize;
+    data.ruleName.assign(reinterpret_cast<const char*>(pos), nameSize);
+    pos += nameSize;
+    unpackCodes(pos, cellCount, data.cells);
+    unpackCodes(pos + packedSize, cellCount, data.previousCells);
+    return data;
+}
+
+std::string Checkpoint::getCheckpointFilename(const std::string& directory, int iteration) {
+    std::ostringstream oss;
+    oss << directory << "/" << CHECKPOINT_PREFIX << iteration << CHECKPOINT_EXTENSION;
+    return oss.str();
+}
+
+std::string Checkpoint::loadLatest(const std::string& directory, CheckpointData& data) {
+    for (const auto& checkpoint : listCheckpoints(directory)) {
+        try {
+            data = read(checkpoint.second);
+            return checkpoint.second;
+        } catch (const std::exception&) {
+            // Fichier incomplet ou corrompu : on essaie le précédent
+        }
+    }
+    return "";
+}
+
+void Checkpoint::prune(const std::string& directory, int keep) {
+    auto checkpoints = listCheckpoints(directory);
+    for (size_t i = static_cast<size_t>(std::max(keep, 0)); i < checkpoints.size(); ++i) {
+        std::error_code ec;
+        fs::remove(checkpoints[i].second, ec);
+    }
+}
@@ -1,24 +1,253 @@
 #include "io/FileHandler.hpp"
-#include "cell/AliveState.hpp"
-#include "cell/DeadState.hpp"
-#include "cell/ObstacleAliveState.hpp"
-#include "cell/ObstacleDeadState.hpp"
+#include "io/MappedFile.hpp"
+#include "util/Tracer.hpp"
 #include <fstream>
 #include <sstream>
 #include <stdexcept>
 #include <iostream>
+#include <algorithm>
+#include <cctype>
+#include <thread>
+#include <vector>
+#include <cstdint>
+#include <cstring>
+#include <array>
+#include <map>
 
 namespace fs = std::filesystem;
 
+namespace {
+
+inline bool isSpace(char c) {
+    return c == ' ' || c == '\n' || c == '\r' || c == '\t' || c == '\v' || c == '\f';
+}
+
+/**
+ * @brief Convertit un jeton en entier (signe optionnel puis chiffres, comme `operator>>`)
+ * @return false si le jeton n'est pas un entier représentable
+ */
+bool parseInt(const char* begin, const char* end, int& value) {
+    bool negative = false;
+    if (*begin == '+' || *begin == '-') {
+        negative = (*begin == '-');
+        ++begin;
+    }
+    if (begin == end || end - begin > 10) return false;
+    
+    long long result = 0;
+    for (const char* p = begin; p < end; ++p) {
+        unsigned digit = static_cast<unsigned>(*p - '0');
+        if (digit > 9) return false;
+        result = result * 10 + digit;
+    }
+    if (negative) result = -result;
+    if (result > 2147483647LL || result < -2147483648LL) return false;
+    value = static_cast<int>(result);
+    return true;
+}
+
+/**
+ * @brief Lit le prochain jeton entier à partir de pos
+ * @return false si aucun entier valide n'a pu être lu
+ */
+bool readNextInt(const char*& pos, const char* end, int& value) {
+    while (pos < end && isSpace(*pos)) ++pos;
+    const char* begin = pos;
+    while (pos < end && !isSpace(*pos)) ++pos;
+    return begin != pos && parseInt(begin, pos, value);
+}
+
+/**
+ * @brief Portion du fichier traitée par un thread, découpée sur une fin de ligne
+ */
+struct ParseChunk {
+    const char* begin;
+    const char* end;
+    size_t tokenCount = 0;          ///< Nombre de jetons (passe 1)
+    size_t firstToken = 0;          ///< Index global du premier jeton (somme préfixe)
+    size_t parsedCount = 0;         ///< Nombre de cellules écrites (passe 2)
+    size_t errorToken = SIZE_MAX;   ///< Index global du premier jeton invalide
+    bool errorIsValue = false;      ///< true : entier hors 0-3, false : jeton non entier
+    int errorValue = 0;             ///< Valeur invalide lue
+};
+
+void countTokens(ParseChunk& chunk) {
+    size_t count = 0;
+    bool inToken = false;
+    for (const char* p = chunk.begin; p < chunk.end; ++p) {
+        bool space = isSpace(*p);
+        count += (!space && !inToken);
+        inToken = !space;
+    }
+    chunk.tokenCount = count;
+}
+
+void parseTokens(ParseChunk& chunk, std::uint8_t* codes, size_t cellCount) {
+    const char* p = chunk.begin;
+    size_t index = chunk.firstToken;
+    
+    while (index < cellCount) {
+        while (p < chunk.end && isSpace(*p)) ++p;
+        if (p == chunk.end) return;
+        const char* tokenBegin = p;
+        while (p < chunk.end && !isSpace(*p)) ++p;
+        
+        // Chemin rapide : un seul chiffre entre 0 et 3
+        unsigned digit = static_cast<unsigned>(*tokenBegin - '0');
+        if (p - tokenBegin == 1 && digit <= 3) {
+            codes[index++] = static_cast<std::uint8_t>(digit);
+            ++chunk.parsedCount;
+            continue;
+        }
+        
+        // Chemin lent : tout entier entre 0 et 3 ("01", "+1"...), comme la lecture par flux
+        int value;
+        if (parseInt(tokenBegin, p, value) && value >= 0 && value <= 3) {
+            codes[index++] = static_cast<std::uint8_t>(value);
+            ++chunk.parsedCount;
+            continue;
+        }
+        chunk.errorToken = index;
+        if (parseInt(tokenBegin, p, value)) {
+            chunk.errorIsValue = true;
+            chunk.errorValue = value;
+        }
+        return;
+    }
+}
+
+// ============================================================================
+// Format macrocell (.mc)
+// ============================================================================
+
+const char* MACROCELL_HEADER = "[M2]";
+const char* MACROCELL_GRID_TAG = "#C grid ";   ///< Dimensions et position de la grille dans la racine
+
+/**
+ * @brief Nœud lu dans un fichier macrocell
+ *
+ * Les niveaux 1 à 3 (blocs de 2x2 à 8x8) sont gardés sous forme de plans de bits,
+ * avec la même disposition que les feuilles du QuadTree (bit = y * 8 + x).
+ */
+struct MacrocellNode {
+    int level;
+    std::uint64_t alive;
+    std::uint64_t obstacle;
+    QuadTree::NodeId id;
+};
+
+/**
+ * @brief Écriture des nœuds d'un QuadTree, enfants avant parents, chaque nœud partagé une seule fois
+ *
+ * Sans obstacle, les feuilles sont écrites au format à deux états (lignes de '.', '*' et '$').
+ * Avec obstacles, le format multi-états est utilisé : nœuds de niveau 1 « 1 a b c d »
+ * portant directement les codes de cellules.
+ */
+class MacrocellWriter {
+private:
+    const QuadTree& m_tree;
+    std::ostream& m_out;
+    bool m_multistate;
+    std::vector<std::uint32_t> m_index;     ///< Numéro de ligne déjà attribué à chaque nœud
+    std::map<std::array<std::uint32_t, 4>, std::uint32_t> m_blocks[3];  ///< Blocs 2x2 et 4x4 déjà écrits
+    std::uint32_t m_count;
+
+    std::uint32_t writeLine(const std::string& line) {
+        m_out << line << '\n';
+        return ++m_count;
+    }
+
+    std::uint32_t writeBlock(int level, std::uint64_t alive, std::uint64_t obstacle, int x0, int y0) {
+        std::array<std::uint32_t, 4> key;
+        if (level == 1) {
+            static const int offsets[4] = {0, 1, 8, 9};
+            for (int q = 0; q < 4; ++q) {
+                int bit = (y0 * 8 + x0) + offsets[q];
+                key[q] = static_cast<std::uint32_t>(((alive >> bit) & 1) | (((obstacle >> bit) & 1) << 1));
+            }
+        } else {
+            int half = 1 << (level - 1);
+            for (int q = 0; q < 4; ++q) {
+                key[q] = writeBlock(level - 1, alive, obstacle, x0 + (q % 2) * half, y0 + (q / 2) * half);
+            }
+        }
+        if (key[0] == 0 && key[1] == 0 && key[2] == 0 && key[3] == 0) return 0;
+
+        if (level < QuadTree::LEAF_LEVEL) {
+            auto it = m_blocks[level].find(key);
+            if (it != m_blocks[level].end()) return it->second;
+        }
+        std::ostringstream line;
+        line << level << ' ' << key[0] << ' ' << key[1] << ' ' << key[2] << ' ' << key[3];
+        std::uint32_t index = writeLine(line.str());
+        if (level < QuadTree::LEAF_LEVEL) m_blocks[level].emplace(key, index);
+        return index;
+    }
+
+    std::uint32_t writeLeaf(std::uint64_t alive) {
+        // Chaque ligne se termine par '$' ; cellules mortes finales et lignes vides finales omises
+        std::string line;
+        int lastRow = 7;
+        while (((alive >> (lastRow * 8)) & 0xFF) == 0) --lastRow;
+        for (int y = 0; y <= lastRow; ++y) {
+            unsigned bits = static_cast<unsigned>(alive >> (y * 8)) & 0xFF;
+            for (int x = 0; bits >> x; ++x) {
+                line += ((bits >> x) & 1) ? '*' : '.';
+            }
+            line += '$';
+        }
+        return writeLine(line);
+    }
+
+public:
+    MacrocellWriter(const QuadTree& tree, std::ostream& out)
+        : m_tree(tree)
+        , m_out(out)
+        , m_multistate(tree.hasObstacles())
+        , m_index(tree.getNodeCount() + 1, 0)
+        , m_count(0)
+    {
+    }
+
+    std::uint32_t write(QuadTree::NodeId id, int level) {
+        if (id == QuadTree::EMPTY) return 0;
+        if (m_index[id] != 0) return m_index[id];
+
+        std::uint32_t index;
+        if (m_tree.isLeaf(id)) {
+            index = m_multistate
+                ? writeBlock(QuadTree::LEAF_LEVEL, m_tree.getLeafAlive(id), m_tree.getLeafObstacle(id), 0, 0)
+                : writeLeaf(m_tree.getLeafAlive(id));
+        } else {
+            const QuadTree::NodeId* children = m_tree.getChildren(id);
+            std::uint32_t c[4];
+            for (int q = 0; q < 4; ++q) {
+                c[q] = write(children[q], level - 1);
+            }
+            std::ostringstream line;
+            line << level << ' ' << c[0] << ' ' << c[1] << ' ' << c[2] << ' ' << c[3];
+            index = writeLine(line.str());
+        }
+        m_index[id] = index;
+        return index;
+    }
+};
+
+} // namespace
+
 std::unique_ptr<Grid> FileHandler::loadFromFile(const std::string& filepath, bool toroidal) {
-    std::ifstream file(filepath);
-    if (!file.is_open()) {
-        throw std::runtime_error("Cannot open file: " + filepath);
+    TraceSpan span("FileHandler::loadFromFile", "io");
+    if (getExtension(filepath) == ".mc") {
+        return loadMacrocell(filepath)->toGrid(toroidal);
     }
     
+    MappedFile file(filepath);
+    const char* pos = file.data();
+    const char* end = file.data() + file.size();
+    
     // Lecture de la première ligne : dimensions
     int height, width;
-    if (!(file >> height >> width)) {
+    if (!readNextInt(pos, end, height) || !readNextInt(pos, end, width)) {
         throw std::runtime_error("Invalid file format: cannot read dimensions");
     }
     
@@ -26,44 +255,84 @@ std::unique_ptr<Grid> FileHandler::loadFromFile(const std::string& filepath, boo
         throw std::runtime_error("Invalid dimensions: must be positive");
     }
     
-    auto grid = std::make_unique<Grid>(width, height, toroidal);
+    const size_t cellCount = static_cast<size_t>(width) * height;
+    std::vector<std::uint8_t> codes(cellCount);
     
-    // Lecture de la matrice de cellules
-    for (int y = 0; y < height; ++y) {
-        for (int x = 0; x < width; ++x) {
-            int value;
-            if (!(file >> value)) {
-                throw std::runtime_error("Invalid file format: not enough cell data");
-            }
-            
-            std::unique_ptr<CellState> state;
-            switch (value) {
-                case 0:
-                    state = std::make_unique<DeadState>();
-                    break;
-                case 1:
-                    state = std::make_unique<AliveState>();
-                    break;
-                case 2:
-                    // Extension : obstacle mort
-                    state = std::make_unique<ObstacleDeadState>();
-                    break;
-                case 3:
-                    // Extension : obstacle vivant
-                    state = std::make_unique<ObstacleAliveState>();
-                    break;
-                default:
-                    throw std::runtime_error("Invalid cell value: " + std::to_string(value));
-            }
-            
-            grid->setCellState(x, y, std::move(state));
+    // Découpe le contenu en portions alignées sur les fins de ligne
+    unsigned int numThreads = std::thread::hardware_concurrency();
+    if (numThreads == 0) numThreads = 4;
+    const size_t bodySize = static_cast<size_t>(end - pos);
+    if (bodySize < (1u << 20)) numThreads = 1;
+    
+    std::vector<ParseChunk> chunks;
+    const char* chunkBegin = pos;
+    for (unsigned int i = 1; i <= numThreads && chunkBegin < end; ++i) {
+        const char* chunkEnd = (i == numThreads) ? end : pos + bodySize * i / numThreads;
+        if (chunkEnd < chunkBegin) chunkEnd = chunkBegin;
+        while (chunkEnd < end && *chunkEnd != '\n') ++chunkEnd;
+        ParseChunk chunk;
+        chunk.begin = chunkBegin;
+        chunk.end = chunkEnd;
+        chunks.push_back(chunk);
+        chunkBegin = chunkEnd;
+    }
+    
+    auto runParallel = [&chunks](auto&& work) {
+        if (chunks.size() <= 1) {
+            for (auto& chunk : chunks) work(chunk);
+            return;
+        }
+        std::vector<std::thread> threads;
+        for (auto& chunk : chunks) {
+            threads.emplace_back([&work, &chunk]() { work(chunk); });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    };
+    
+    // Passe 1 : nombre de jetons par portion, puis position globale de chaque portion
+    if (chunks.size() > 1) {
+        runParallel(countTokens);
+        size_t firstToken = 0;
+        for (auto& chunk : chunks) {
+            chunk.firstToken = firstToken;
+            firstToken += chunk.tokenCount;
         }
     }
     
-    return grid;
+    // Passe 2 : analyse des chiffres directement dans le tampon de la grille
+    runParallel([&codes, cellCount](ParseChunk& chunk) { parseTokens(chunk, codes.data(), cellCount); });
+    
+    // La première erreur dans l'ordre du fichier l'emporte, comme en lecture séquentielle
+    const ParseChunk* error = nullptr;
+    for (const auto& chunk : chunks) {
+        if (chunk.errorToken != SIZE_MAX && (!error || chunk.errorToken < error->errorToken)) {
+            error = &chunk;
+        }
+    }
+    if (error && error->errorIsValue) {
+        throw std::runtime_error("Invalid cell value: " + std::to_string(error->errorValue));
+    }
+    
+    size_t cellsRead = 0;
+    for (const auto& chunk : chunks) {
+        cellsRead += chunk.parsedCount;
+    }
+    if (error || cellsRead < cellCount) {
+        throw std::runtime_error("Invalid file format: not enough cell data");
+    }
+    
+    return std::make_unique<Grid>(width, height, codes, toroidal);
 }
 
 void FileHandler::saveToFile(const Grid& grid, const std::string& filepath) {
+    TraceSpan span("FileHandler::saveToFile", "io");
+    if (getExtension(filepath) == ".mc") {
+        saveMacrocell(*QuadTreeBuilder::fromGrid(grid), filepath);
+        return;
+    }
+    
     std::ofstream file(filepath);
     if (!file.is_open()) {
         throw std::runtime_error("Cannot create file: " + filepath);
@@ -85,6 +354,288 @@ void FileHandler::saveToFile(const Grid& grid, const std::string& filepath) {
     }
 }
 
+void FileHandler::saveCodes(int width, int height, const std::vector<std::uint8_t>& codes,
+                            const std::string& filepath) {
+    TraceSpan span("FileHandler::saveCodes", "io");
+    if (getExtension(filepath) == ".mc") {
+        QuadTreeBuilder builder(width, height);
+        for (int y = 0; y < height; ++y) {
+            builder.addRow(codes.data() + static_cast<size_t>(y) * width);
+        }
+        saveMacrocell(*builder.finish(), filepath);
+        return;
+    }
+    
+    std::ofstream file(filepath);
+    if (!file.is_open()) {
+        throw std::runtime_error("Cannot create file: " + filepath);
+    }
+    
+    // Écrit les dimensions
+    file << height << " " << width << "\n";
+    
+    // Écrit la matrice ligne par ligne
+    std::string line;
+    for (int y = 0; y < height; ++y) {
+        const std::uint8_t* rowCodes = codes.data() + static_cast<size_t>(y) * width;
+        line.clear();
+        for (int x = 0; x < width; ++x) {
+            line += static_cast<char>('0' + (rowCodes[x] & 1));
+            if (x < width - 1) {
+                line += ' ';
+            }
+        }
+        line += '\n';
+        file << line;
+    }
+    if (!file) {
+        throw std::runtime_error("Cannot write file: " + filepath);
+    }
+}
+
+std::unique_ptr<BandedGrid> FileHandler::loadBandedGrid(const std::string& filepath, const std::string& storagePath,
+                                                     bool toroidal, int bandRows) {
+    if (getExtension(filepath) == ".mc") {
+        // L'arbre est parcouru ligne par ligne : la grille dense n'est jamais construite
+        auto tree = loadMacrocell(filepath);
+        auto grid = std::make_unique<BandedGrid>(storagePath, tree->getWidth(), tree->getHeight(),
+                                                 toroidal, bandRows);
+        grid->importRows([&tree](int y, std::uint8_t* rowCodes) { tree->fillRow(y, rowCodes); });
+        return grid;
+    }
+    
+    MappedFile file(filepath);
+    const char* pos = file.data();
+    const char* end = file.data() + file.size();
+    
+    // Lecture de la première ligne : dimensions
+    int height, width;
+    if (!readNextInt(pos, end, height) || !readNextInt(pos, end, width)) {
+        throw std::runtime_error("Invalid file format: cannot read dimensions");
+    }
+    
+    if (height <= 0 || width <= 0) {
+        throw std::runtime_error("Invalid dimensions: must be positive");
+    }
+    
+    auto grid = std::make_unique<BandedGrid>(storagePath, width, height, toroidal, bandRows);
+    
+    // Lecture séquentielle de la matrice, une ligne à la fois
+    grid->importRows([&pos, end, width](int, std::uint8_t* rowCodes) {
+        for (int x = 0; x < width; ++x) {
+            int value;
+            if (!readNextInt(pos, end, value)) {
+                throw std::runtime_error("Invalid file format: not enough cell data");
+            }
+            if (value < 0 || value > 3) {
+                throw std::runtime_error("Invalid cell value: " + std::to_string(value));
+            }
+            rowCodes[x] = static_cast<std::uint8_t>(value);
+        }
+    });
+    
+    return grid;
+}
+
+void FileHandler::saveToFile(const BandedGrid& grid, const std::string& filepath) {
+    TraceSpan span("FileHandler::saveToFile", "io");
+    if (getExtension(filepath) == ".mc") {
+        QuadTreeBuilder builder(grid.getWidth(), grid.getHeight());
+        grid.exportRows([&builder](int, const std::uint8_t* rowCodes) { builder.addRow(rowCodes); });
+        saveMacrocell(*builder.finish(), filepath);
+        return;
+    }
+    
+    std::ofstream file(filepath);
+    if (!file.is_open()) {
+        throw std::runtime_error("Cannot create file: " + filepath);
+    }
+    
+    // Écrit les dimensions
+    file << grid.getHeight() << " " << grid.getWidth() << "\n";
+    
+    // Écrit la matrice ligne par ligne (seule la bande courante est en mémoire)
+    std::string line;
+    grid.exportRows([&file, &line, &grid](int, const std::uint8_t* rowCodes) {
+        line.clear();
+        for (int x = 0; x < grid.getWidth(); ++x) {
+            line += static_cast<char>('0' + (rowCodes[x] & 1));
+            if (x < grid.getWidth() - 1) {
+                line += ' ';
+            }
+        }
+        line += '\n';
+        file << line;
+    });
+}
+
+std::unique_ptr<QuadTree> FileHandler::loadMacrocell(const std::string& filepath) {
+    MappedFile file(filepath);
+    const char* pos = file.data();
+    const char* end = file.data() + file.size();
+    
+    auto tree = std::make_unique<QuadTree>(1, 1);
+    std::vector<MacrocellNode> nodes(1, {0, 0, 0, QuadTree::EMPTY});  // Ligne 0 : nœud vide
+    bool hasGrid = false;
+    int gridWidth = 0, gridHeight = 0, gridX = 0, gridY = 0;
+    int lineNumber = 0;
+    
+    while (pos < end) {
+        const char* lineEnd = static_cast<const char*>(std::memchr(pos, '\n', static_cast<size_t>(end - pos)));
+        if (!lineEnd) lineEnd = end;
+        const char* lineBegin = pos;
+        pos = (lineEnd < end) ? lineEnd + 1 : end;
+        ++lineNumber;
+        
+        const char* last = lineEnd;
+        while (last > lineBegin && isSpace(last[-1])) --last;
+        const std::string error = "Invalid macrocell format: line " + std::to_string(lineNumber);
+        
+        if (lineNumber == 1) {
+            if (static_cast<size_t>(last - lineBegin) < std::strlen(MACROCELL_HEADER) ||
+                std::memcmp(lineBegin, MACROCELL_HEADER, std::strlen(MACROCELL_HEADER)) != 0) {
+                throw std::runtime_error("Invalid macrocell format: missing [M2] header");
+            }
+            continue;
+        }
+        if (last == lineBegin) continue;
+        
+        // Commentaires et métadonnées (la règle #R est ignorée : seule la règle classique est gérée)
+        if (*lineBegin == '#') {
+            size_t tagLength = std::strlen(MACROCELL_GRID_TAG);
+            if (static_cast<size_t>(last - lineBegin) > tagLength &&
+                std::memcmp(lineBegin, MACROCELL_GRID_TAG, tagLength) == 0) {
+                const char* p = lineBegin + tagLength;
+                if (!readNextInt(p, last, gridWidth) || !readNextInt(p, last, gridHeight) ||
+                    !readNextInt(p, last, gridX) || !readNextInt(p, last, gridY) ||
+                    gridWidth <= 0 || gridHeight <= 0 || gridX < 0 || gridY < 0) {
+                    throw std::runtime_error(error);
+                }
+                hasGrid = true;
+            }
+            continue;
+        }
+        
+        MacrocellNode node{QuadTree::LEAF_LEVEL, 0, 0, QuadTree::EMPTY};
+        
+        if (*lineBegin == '.' || *lineBegin == '*' || *lineBegin == '$') {
+            // Feuille 8x8 à deux états
+            int x = 0, y = 0;
+            for (const char* p = lineBegin; p < last; ++p) {
+                if (*p == '$') {
+                    x = 0;
+                    ++y;
+                } else if ((*p == '.' || *p == '*') && x < 8 && y < 8) {
+                    if (*p == '*') node.alive |= 1ULL << (y * 8 + x);
+                    ++x;
+                } else {
+                    throw std::runtime_error(error);
+                }
+            }
+        } else {
+            int values[5];
+            const char* p = lineBegin;
+            for (int& value : values) {
+                if (!readNextInt(p, last, value)) throw std::runtime_error(error);
+            }
+            node.level = values[0];
+            if (node.level < 1 || node.level > QuadTree::MAX_LEVEL) throw std::runtime_error(error);
+            
+            if (node.level == 1) {
+                // Nœud multi-états : codes des quatre cellules
+                static const int offsets[4] = {0, 1, 8, 9};
+                for (int q = 0; q < 4; ++q) {
+                    int code = values[q + 1];
+                    if (code < 0 || code > 3) {
+                        throw std::runtime_error("Invalid cell value: " + std::to_string(code));
+                    }
+                    node.alive |= static_cast<std::uint64_t>(code & 1) << offsets[q];
+                    node.obstacle |= static_cast<std::uint64_t>((code >> 1) & 1) << offsets[q];
+                }
+            } else {
+                // Les enfants sont des lignes précédentes du niveau inférieur
+                const MacrocellNode* children[4];
+                for (int q = 0; q < 4; ++q) {
+                    int child = values[q + 1];
+                    if (child < 0 || child >= static_cast<int>(nodes.size()) ||
+                        (child != 0 && nodes[child].level != node.level - 1)) {
+                        throw std::runtime_error(error);
+                    }
+                    children[q] = &nodes[child];
+                }
+                
+                if (node.level <= QuadTree::LEAF_LEVEL) {
+                    int half = 1 << (node.level - 1);
+                    for (int q = 0; q < 4; ++q) {
+                        int shift = (q / 2) * half * 8 + (q % 2) * half;
+                        node.alive |= children[q]->alive << shift;
+                        node.obstacle |= children[q]->obstacle << shift;
+                    }
+                } else {
+                    node.id = tree->makeNode(node.level, children[0]->id, children[1]->id,
+                                             children[2]->id, children[3]->id);
+                }
+            }
+        }
+        
+        if (node.level == QuadTree::LEAF_LEVEL) {
+            node.id = tree->makeLeaf(node.alive, node.obstacle);
+        }
+        nodes.push_back(node);
+    }
+    
+    if (lineNumber == 0) {
+        throw std::runtime_error("Invalid macrocell format: missing [M2] header");
+    }
+    
+    // La racine est le dernier nœud ; un petit bloc multi-états devient une feuille
+    const MacrocellNode& top = nodes.back();
+    QuadTree::NodeId root = top.id;
+    int rootLevel = std::max(top.level, QuadTree::LEAF_LEVEL);
+    if (top.level > 0 && top.level < QuadTree::LEAF_LEVEL) {
+        root = tree->makeLeaf(top.alive, top.obstacle);
+    }
+    
+    if (hasGrid) {
+        // Agrandit la racine (coin nord-ouest) si la grille déclarée la dépasse
+        long long extent = std::max(static_cast<long long>(gridX) + gridWidth, static_cast<long long>(gridY) + gridHeight);
+        while ((1LL << rootLevel) < extent) {
+            root = tree->makeNode(rootLevel + 1, root, QuadTree::EMPTY, QuadTree::EMPTY, QuadTree::EMPTY);
+            ++rootLevel;
+        }
+        tree->setRoot(root, rootLevel);
+        tree->setWindow(gridX, gridY, gridWidth, gridHeight);
+    } else {
+        tree->setRoot(root, rootLevel);
+        if (!tree->cropToContent()) {
+            throw std::runtime_error("Invalid macrocell format: empty pattern");
+        }
+    }
+    
+    return tree;
+}
+
+void FileHandler::saveMacrocell(const QuadTree& tree, const std::string& filepath) {
+    std::ofstream file(filepath);
+    if (!file.is_open()) {
+        throw std::runtime_error("Cannot create file: " + filepath);
+    }
+    
+    file << MACROCELL_HEADER << " (gameoflife)\n";
+    if (!tree.hasObstacles()) {
+        file << "#R B3/S23\n";
+    }
+    file << MACROCELL_GRID_TAG << tree.getWidth() << " " << tree.getHeight() << " "
+         << tree.getOriginX() << " " << tree.getOriginY() << "\n";
+    
+    MacrocellWriter writer(tree, file);
+    writer.write(tree.getRoot(), tree.getRootLevel());
+    
+    if (!file) {
+        throw std::runtime_error("Cannot write to file: " + filepath);
+    }
+}
+
 std::string FileHandler::createOutputDirectory(const std::string& inputFilepath) {
     std::string baseName = getBaseName(inputFilepath);
     std::string outputDir = baseName + "_out";
@@ -95,9 +646,10 @@ std::string FileHandler::createOutputDirectory(const std::string& inputFilepath)
     return outputDir;
 }
 
-std::string FileHandler::getIterationFilename(const std::string& outputDir, int iteration) {
+std::string FileHandler::getIterationFilename(const std::string& outputDir, int iteration,
+                                             const std::string& extension) {
     std::ostringstream oss;
-    oss << outputDir << "/iteration_" << iteration << ".txt";
+    oss << outputDir << "/iteration_" << iteration << extension;
     return oss.str();
 }
 
@@ -106,5 +658,9 @@ std::string FileHandler::getBaseName(const std::string& filepath) {
     return path.stem().string();
 }
 
-
-
+std::string FileHandler::getExtension(const std::string& filepath) {
+    std::string ext = fs::path(filepath).extension().string();
+    std::transform(ext.begin(), ext.end(), ext.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return ext;
+}
@@ -0,0 +1,303 @@
+#include "io/GenerationArchive.hpp"
+#include "io/BinaryIO.hpp"
+#include <stdexcept>
+#include <cstring>
+
+using namespace BinaryIO;
+
+namespace {
+
+const char ARCHIVE_MAGIC[8] = {'G', 'O', 'L', 'A', 'R', 'C', 'H', '1'};
+const char INDEX_MAGIC[8] = {'G', 'O', 'L', 'A', 'I', 'D', 'X', '1'};
+const std::uint32_t ARCHIVE_VERSION = 1;
+const std::uint64_t HEADER_SIZE = 8 + 4 + 4 + 4 + 1 + 4;
+const std::uint64_t FOOTER_SIZE = 8 + 8;
+
+// Marqueurs d'enregistrements
+const char RECORD_KEYFRAME = 'K';
+const char RECORD_DELTA = 'D';
+const char RECORD_INDEX = 'I';
+
+/**
+ * @brief Encode une image complète : suites de (longueur, code)
+ */
+std::vector<std::uint8_t> encodeKeyframe(const std::vector<std::uint8_t>& codes) {
+    std::vector<std::uint8_t> out;
+    size_t i = 0;
+    while (i < codes.size()) {
+        size_t run = 1;
+        while (i + run < codes.size() && codes[i + run] == codes[i]) ++run;
+        putVarint(out, run);
+        out.push_back(codes[i]);
+        i += run;
+    }
+    return out;
+}
+
+/**
+ * @brief Encode un delta : pour chaque cellule modifiée, (écart depuis la précédente, nouveau code)
+ */
+std::vector<std::uint8_t> encodeDelta(const std::vector<std::uint8_t>& previous,
+                                      const std::vector<std::uint8_t>& codes) {
+    std::vector<std::uint8_t> out;
+    size_t next = 0;
+    for (size_t i = 0; i < codes.size(); ++i) {
+        if (codes[i] != previous[i]) {
+            putVarint(out, i - next);
+            out.push_back(codes[i]);
+            next = i + 1;
+        }
+    }
+    return out;
+}
+
+void decodeKeyframe(const std::vector<std::uint8_t>& payload, std::vector<std::uint8_t>& codes) {
+    size_t pos = 0;
+    size_t cell = 0;
+    while (pos < payload.size()) {
+        std::uint64_t run = getVarint(payload, pos);
+        if (pos >= payload.size() || run > codes.size() - cell) {
+            throw std::runtime_error("Corrupted archive: invalid keyframe");
+        }
+        std::memset(codes.data() + cell, payload[pos++], static_cast<size_t>(run));
+        cell += static_cast<size_t>(run);
+    }
+    if (cell != codes.size()) {
+        throw std::runtime_error("Corrupted archive: incomplete keyframe");
+    }
+}
+
+void applyDelta(const std::vector<std::uint8_t>& payload, std::vector<std::uint8_t>& codes) {
+    size_t pos = 0;
+    size_t cell = 0;
+    while (pos < payload.size()) {
+        std::uint64_t gap = getVarint(payload, pos);
+        if (pos >= payload.size() || gap >= codes.size() - cell) {
+            throw std::runtime_error("Corrupted archive: invalid delta");
+        }
+        cell += static_cast<size_t>(gap);
+        codes[cell++] = payload[pos++];
+    }
+}
+
+} // namespace
+
+// ============================================================================
+// ArchiveWriter
+// ============================================================================
+
+ArchiveWriter::ArchiveWriter(const std::string& filepath, int width, int height, bool toroidal,
+                             int keyframeInterval)
+    : m_file(filepath, std::ios::binary | std::ios::trunc)
+    , m_filepath(filepath)
+    , m_width(width)
+    , m_height(height)
+    , m_keyframeInterval(keyframeInterval > 0 ? keyframeInterval : 1)
+    , m_closed(false)
+{
+    if (!m_file.is_open()) {
+        throw std::runtime_error("Cannot create file: " + filepath);
+    }
+    if (width <= 0 || height <= 0) {
+        throw std::invalid_argument("Archive dimensions must be positive");
+    }
+
+    std::vector<std::uint8_t> header(ARCHIVE_MAGIC, ARCHIVE_MAGIC + 8);
+    putU32(header, ARCHIVE_VERSION);
+    putU32(header, static_cast<std::uint32_t>(width));
+    putU32(header, static_cast<std::uint32_t>(height));
+    header.push_back(toroidal ? 1 : 0);
+    putU32(header, static_cast<std::uint32_t>(m_keyframeInterval));
+    m_file.write(reinterpret_cast<const char*>(header.data()), static_cast<std::streamsize>(header.size()));
+}
+
+ArchiveWriter::~ArchiveWriter() {
+    try {
+        close();
+    } catch (...) {
+        // Un destructeur ne doit pas lever d'exception
+    }
+}
+
+void ArchiveWriter::append(const Grid& grid) {
+    if (m_closed) {
+        throw std::runtime_error("Archive already closed: " + m_filepath);
+    }
+    if (grid.getWidth() != m_width || grid.getHeight() != m_height) {
+        throw std::runtime_error("Grid dimensions do not match archive: " + m_filepath);
+    }
+
+    std::vector<std::uint8_t> codes = grid.toCodes();
+    int generation = static_cast<int>(m_index.size());
+    bool keyframe = (generation % m_keyframeInterval == 0);
+
+    std::vector<std::uint8_t> payload = keyframe ? encodeKeyframe(codes) : encodeDelta(m_previous, codes);
+
+    std::vector<std::uint8_t> record;
+    record.push_back(static_cast<std::uint8_t>(keyframe ? RECORD_KEYFRAME : RECORD_DELTA));
+    putU32(record, static_cast<std::uint32_t>(generation));
+    putU32(record, static_cast<std::uint32_t>(payload.size()));
+
+    std::uint64_t offset = static_cast<std::uint64_t>(m_file.tellp());
+    m_file.write(reinterpret_cast<const char*>(record.data()), static_cast<std::streamsize>(record.size()));
+    m_file.write(reinterpret_cast<const char*>(payload.data()), static_cast<std::streamsize>(payload.size()));
+    if (!m_file) {
+        throw std::runtime_error("Cannot write to file: " + m_filepath);
+    }
+
+    m_index.push_back({generation, keyframe, offset});
+    m_previous = std::move(codes);
+}
+
+void ArchiveWriter::close() {
+    if (m_closed) return;
+    m_closed = true;
+
+    std::uint64_t indexOffset = static_cast<std::uint64_t>(m_file.tellp());
+    std::vector<std::uint8_t> index;
+    index.push_back(static_cast<std::uint8_t>(RECORD_INDEX));
+    putU32(index, static_cast<std::uint32_t>(m_index.size()));
+    for (const auto& entry : m_index) {
+        putU32(index, static_cast<std::uint32_t>(entry.generation));
+        index.push_back(entry.keyframe ? 1 : 0);
+        putU64(index, entry.offset);
+    }
+    putU64(index, indexOffset);
+    index.insert(index.end(), INDEX_MAGIC, INDEX_MAGIC + 8);
+
+    m_file.write(reinterpret_cast<const char*>(index.data()), static_cast<std::streamsize>(index.size()));
+    m_file.close();
+    if (m_file.fail()) {
+        throw std::runtime_error("Cannot write to file: " + m_filepath);
+    }
+}
+
+// ============================================================================
+// ArchiveReader
+// ============================================================================
+
+ArchiveReader::ArchiveReader(const std::string& filepath)
+    : m_file(filepath, std::ios::binary)
+    , m_width(0)
+    , m_height(0)
+    , m_toroidal(false)
+    , m_keyframeInterval(1)
+{
+    if (!m_file.is_open()) {
+        throw std::runtime_error("Cannot open file: " + filepath);
+    }
+
+    std::uint8_t header[HEADER_SIZE];
+    if (!m_file.read(reinterpret_cast<char*>(header), HEADER_SIZE) ||
+        std::memcmp(header, ARCHIVE_MAGIC, 8) != 0) {
+        throw std::runtime_error("Invalid archive format: " + filepath);
+    }
+    if (getU32(header + 8) != ARCHIVE_VERSION) {
+        throw std::runtime_error("Unsupported archive version: " + filepath);
+    }
+    m_width = static_cast<int>(getU32(header + 12));
+    m_height = static_cast<int>(getU32(header + 16));
+    m_toroidal = header[20] != 0;
+    m_keyframeInterval = static_cast<int>(getU32(header + 21));
+    if (m_width <= 0 || m_height <= 0) {
+        throw std::runtime_error("Invalid dimensions: must be positive");
+    }
+
+    // Lecture de l'index final s'il est présent
+    m_file.seekg(0, std::ios::end);
+    std::uint64_t fileSize = static_cast<std::uint64_t>(m_file.tellg());
+    bool indexFound = false;
+
+    if (fileSize >= HEADER_SIZE + FOOTER_SIZE) {
+        std::uint8_t footer[FOOTER_SIZE];
+        m_file.seekg(static_cast<std::streamoff>(fileSize - FOOTER_SIZE));
+        m_file.read(reinterpret_cast<char*>(footer), FOOTER_SIZE);
+        std::uint64_t indexOffset = getU64(footer);
+
+        if (m_file && std::memcmp(footer + 8, INDEX_MAGIC, 8) == 0 &&
+            indexOffset >= HEADER_SIZE && indexOffset + 5 <= fileSize - FOOTER_SIZE) {
+            std::vector<std::uint8_t> block(static_cast<size_t>(fileSize - FOOTER_SIZE - indexOffset));
+            m_file.seekg(static_cast<std::streamoff>(indexOffset));
+            m_file.read(reinterpret_cast<char*>(block.data()), static_cast<std::streamsize>(block.size()));
+
+            std::uint32_t count = getU32(block.data() + 1);
+            if (m_file && block[0] == RECORD_INDEX && block.size() == 5 + static_cast<size_t>(count) * 13) {
+                m_index.reserve(count);
+                for (std::uint32_t i = 0; i < count; ++i) {
+                    const std::uint8_t* entry = block.data() + 5 + i * 13;
+                    m_index.push_back({static_cast<int>(getU32(entry)), entry[4] != 0, getU64(entry + 5)});
+                }
+                indexFound = true;
+            }
+        }
+    }
+
+    if (!indexFound) {
+        // Archive interrompue avant l'écriture de l'index
+        m_file.clear();
+        scanRecords(HEADER_SIZE);
+    }
+}
+
+void ArchiveReader::scanRecords(std::uint64_t dataStart) {
+    m_file.seekg(0, std::ios::end);
+    std::uint64_t fileSize = static_cast<std::uint64_t>(m_file.tellg());
+    std::uint64_t offset = dataStart;
+
+    while (offset + 9 <= fileSize) {
+        std::uint8_t record[9];
+        m_file.seekg(static_cast<std::streamoff>(offset));
+        if (!m_file.read(reinterpret_cast<char*>(record), 9)) break;
+        if (record[0] != RECORD_KEYFRAME && record[0] != RECORD_DELTA) break;
+
+        int generation = static_cast<int>(getU32(record + 1));
+        std::uint64_t size = getU32(record + 5);
+        if (generation != static_cast<int>(m_index.size()) || offset + 9 + size > fileSize) break;
+
+        m_index.push_back({generation, record[0] == RECORD_KEYFRAME, offset});
+        offset += 9 + size;
+    }
+    m_file.clear();
+}
+
+std::vector<std::uint8_t> ArchiveReader::readCodes(int generation) const {
+    if (generation < 0 || generation >= static_cast<int>(m_index.size())) {
+        throw std::out_of_range("Generation not found in archive: " + std::to_string(generation));
+    }
+
+    // Recherche de la dernière image clé précédant la génération demandée
+    int start = generation;
+    while (start > 0 && !m_index[start].keyframe) --start;
+    if (!m_index[start].keyframe) {
+        throw std::runtime_error("Corrupted archive: missing keyframe");
+    }
+
+    std::vector<std::uint8_t> codes(static_cast<size_t>(m_width) * m_height, 0);
+    std::vector<std::uint8_t> payload;
+
+    for (int g = start; g <= generation; ++g) {
+        std::uint8_t record[9];
+        m_file.clear();
+        m_file.seekg(static_cast<std::streamoff>(m_index[g].offset));
+        if (!m_file.read(reinterpret_cast<char*>(record), 9)) {
+            throw std::runtime_error("Corrupted archive: truncated record");
+        }
+        payload.resize(getU32(record + 5));
+        if (!m_file.read(reinterpret_cast<char*>(payload.data()), static_cast<std::streamsize>(payload.size()))) {
+            throw std::runtime_error("Corrupted archive: truncated record");
+        }
+
+        if (record[0] == RECORD_KEYFRAME) {
+            decodeKeyframe(payload, codes);
+        } else {
+            applyDelta(payload, codes);
+        }
+    }
+    return codes;
+}
+
+std::unique_ptr<Grid> ArchiveReader::readGeneration(int generation) const {
+    auto grid = std::make_unique<Grid>(m_width, m_height, m_toroidal);
+    grid->fromCodes(readCodes(generation));
+    return grid;
+}
@@ -0,0 +1,99 @@
+#include "io/MappedFile.hpp"
+#include <stdexcept>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#ifdef _WIN32
+
+MappedFile::MappedFile(const std::string& filepath)
+    : m_data(nullptr)
+    , m_size(0)
+    , m_fileHandle(INVALID_HANDLE_VALUE)
+    , m_mappingHandle(nullptr)
+{
+    HANDLE file = CreateFileA(filepath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                              OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        throw std::runtime_error("Cannot open file: " + filepath);
+    }
+    m_fileHandle = file;
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size)) {
+        CloseHandle(file);
+        throw std::runtime_error("Cannot open file: " + filepath);
+    }
+    m_size = static_cast<std::size_t>(size.QuadPart);
+    if (m_size == 0) return;
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!mapping) {
+        CloseHandle(file);
+        throw std::runtime_error("Cannot map file: " + filepath);
+    }
+    m_mappingHandle = mapping;
+
+    m_data = static_cast<const char*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+    if (!m_data) {
+        CloseHandle(mapping);
+        CloseHandle(file);
+        throw std::runtime_error("Cannot map file: " + filepath);
+    }
+}
+
+MappedFile::~MappedFile() {
+    if (m_data) UnmapViewOfFile(m_data);
+    if (m_mappingHandle) CloseHandle(static_cast<HANDLE>(m_mappingHandle));
+    if (m_fileHandle != INVALID_HANDLE_VALUE) CloseHandle(static_cast<HANDLE>(m_fileHandle));
+}
+
+#else
+
+MappedFile::MappedFile(const std::string& filepath)
+    : m_data(nullptr)
+    , m_size(0)
+{
+    int fd = ::open(filepath.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error("Cannot open file: " + filepath);
+    }
+
+    struct stat info;
+    if (::fstat(fd, &info) != 0 || !S_ISREG(info.st_mode)) {
+        ::close(fd);
+        throw std::runtime_error("Cannot open file: " + filepath);
+    }
+    m_size = static_cast<std::size_t>(info.st_size);
+
+    if (m_size > 0) {
+        void* addr = ::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (addr == MAP_FAILED) {
+            ::close(fd);
+            throw std::runtime_error("Cannot map file: " + filepath);
+        }
+        // Lecture séquentielle : encourage le noyau à lire en avance
+        ::madvise(addr, m_size, MADV_SEQUENTIAL);
+        m_data = static_cast<const char*>(addr);
+    }
+
+    // La projection reste valide après la fermeture du descripteur
+    ::close(fd);
+}
+
+MappedFile::~MappedFile() {
+    if (m_data) {
+        ::munmap(const_cast<char*>(m_data), m_size);
+    }
+}
+
+#endif
@@ -9,25 +9,138 @@
 #include <iostream>
 #include <string>
 #include <cstdlib>
+#include <memory>
+#include <filesystem>
 #include "game/Game.hpp"
 #include "grid/Grid.hpp"
 #include "rules/ClassicRule.hpp"
 #include "io/FileHandler.hpp"
+#include "io/GenerationArchive.hpp"
+#include "game/OutOfCoreGame.hpp"
+#include "io/Checkpoint.hpp"
+#include "io/AsyncWriter.hpp"
+#include "game/BatchRunner.hpp"
+#include "game/SoupRunner.hpp"
+#include "game/AutoTuner.hpp"
+#include "util/Metrics.hpp"
+#include "util/Tracer.hpp"
+#include "util/StatsServer.hpp"
+#include <fstream>
+#include <chrono>
+#include <algorithm>
+#include <vector>
+#include <csignal>
+
+/**
+ * @brief Demande d'écriture des métriques en cours de simulation (SIGUSR1)
+ */
+volatile std::sig_atomic_t g_metricsRequested = 0;
+
+void requestMetrics(int) {
+    g_metricsRequested = 1;
+}
+
+/**
+ * @brief Écrit les métriques par phase au format JSON
+ * @param filename Fichier de sortie (vide = rien à écrire)
+ */
+void writeMetrics(const std::string& filename) {
+    if (filename.empty()) return;
+    std::ofstream out(filename);
+    if (!out.is_open()) {
+        std::cerr << "Erreur: Impossible d'écrire les métriques dans " << filename << "\n";
+        return;
+    }
+    Metrics::instance().writeJson(out);
+}
+
+/**
+ * @brief Arrête le traceur et écrit la trace Chrome (JSON)
+ * @param filename Fichier de sortie (vide = pas de trace)
+ */
+void writeTrace(const std::string& filename) {
+    if (filename.empty()) return;
+    Tracer& tracer = Tracer::instance();
+    tracer.stop();
+    std::ofstream out(filename);
+    if (!out.is_open()) {
+        std::cerr << "Erreur: Impossible d'écrire la trace dans " << filename << "\n";
+        return;
+    }
+    tracer.writeJson(out);
+    std::cout << "Trace: " << filename << " (" << tracer.getEventCount() << " événements";
+    if (tracer.getDroppedCount() > 0) {
+        std::cout << ", " << tracer.getDroppedCount() << " ignorés";
+    }
+    std::cout << ")\n";
+}
+
+/**
+ * @brief Calcule la population et les tuiles actives et les publie sur /metrics
+ *
+ * Parcourt toute la grille : appelé au démarrage puis seulement après une lecture de /metrics.
+ */
+void publishPopulation(StatsServer& server, const Grid& grid, int generation) {
+    const int tile = StatsServer::TILE_SIZE;
+    const int tilesX = (grid.getWidth() + tile - 1) / tile;
+    long long population = 0;
+    long long activeTiles = 0;
+    std::vector<char> tileActive(static_cast<size_t>(tilesX), 0);
+    for (int y = 0; y < grid.getHeight(); ++y) {
+        if (y % tile == 0) {
+            std::fill(tileActive.begin(), tileActive.end(), 0);
+        }
+        for (int x = 0; x < grid.getWidth(); ++x) {
+            if (grid.getCell(x, y).isAlive()) {
+                ++population;
+                char& active = tileActive[static_cast<size_t>(x / tile)];
+                if (!active) {
+                    active = 1;
+                    ++activeTiles;
+                }
+            }
+        }
+    }
+    server.publishPopulation(generation, population, activeTiles);
+}
 
 void printUsage(const char* programName) {
     std::cout << "Jeu de la Vie - Mode Console\n";
     std::cout << "============================\n\n";
-    std::cout << "Usage: " << programName << " <fichier_entree> [options]\n\n";
+    std::cout << "Usage: " << programName << " <fichier_entree> [options]\n";
+    std::cout << "       " << programName << " --batch <dossier|manifeste> [options]\n";
+    std::cout << "       " << programName << " --soups <nombre> [options]\n\n";
     std::cout << "Options:\n";
     std::cout << "  -n <nombre>    Nombre d'itérations (défaut: 100)\n";
     std::cout << "  -t             Activer le mode torique\n";
-    std::cout << "  -p             Activer le calcul parallèle\n";
+    std::cout << "  -p             Activer le calcul parallèle (sans -p : stratégie du profil --tune, sinon séquentiel)\n";
     std::cout << "  -v             Mode verbeux (affiche la grille à chaque itération)\n";
+    std::cout << "  -a <fichier>   Écrire une archive unique (.gola) au lieu du dossier _out\n";
+    std::cout << "  -k <nombre>    Intervalle entre images clés de l'archive (défaut: 64)\n";
+    std::cout << "  -b <lignes>    Simulation hors mémoire : grille sur disque par bandes de <lignes> lignes\n";
+    std::cout << "  -f <txt|mc>    Format des fichiers d'itérations (défaut: txt)\n";
+    std::cout << "  -c <nombre>    Point de contrôle toutes les <nombre> itérations\n";
+    std::cout << "  --checkpoint-dir <dossier>  Dossier des points de contrôle (défaut: <nom>_ckpt)\n";
+    std::cout << "  --resume       Reprendre depuis le dernier point de contrôle\n";
+    std::cout << "  --batch <src>  Simuler tous les fichiers d'un dossier ou d'un manifeste (un chemin par ligne)\n";
+    std::cout << "  --soups <n>    Simuler <n> soupes aléatoires jusqu'à stabilisation\n";
+    std::cout << "  --tune         Mesurer les stratégies de calcul pour --size/--density/-t (défaut: 256x256)\n";
+    std::cout << "                 et enregistrer la plus rapide dans le profil (gameoflife_tuning.cfg ou $GAMEOFLIFE_TUNING)\n";
+    std::cout << "  --size <LxH>   Taille des soupes (défaut: 32x32)\n";
+    std::cout << "  --density <d>  Densité initiale des soupes (défaut: 0.5)\n";
+    std::cout << "  --seed <s>     Graine des soupes (défaut: 1)\n";
+    std::cout << "  -j <threads>   Nombre de threads des modes lot et soupes (défaut: nombre de cœurs)\n";
+    std::cout << "  --summary <f>  Tableau CSV des résultats (lot: batch_summary.csv par défaut ; soupes: aucun)\n";
+    std::cout << "  --metrics <f>  Temps par phase (histogrammes JSON) écrits en fin d'exécution\n";
+    std::cout << "                 (et à chaque signal SIGUSR1 sous Linux/macOS)\n";
+    std::cout << "  --metrics-port <port>  Exposer l'état de la simulation sur http://127.0.0.1:<port>/metrics (Prometheus)\n";
+    std::cout << "  --trace <f>    Trace chronologique (Chrome/Perfetto JSON) écrite en fin d'exécution\n";
     std::cout << "  -h             Afficher cette aide\n\n";
     std::cout << "Format du fichier d'entrée:\n";
     std::cout << "  Première ligne: <hauteur> <largeur>\n";
     std::cout << "  Lignes suivantes: matrice de 0 (mort) et 1 (vivant)\n";
-    std::cout << "  Extension: 2 = obstacle mort, 3 = obstacle vivant\n\n";
+    std::cout << "  Extension: 2 = obstacle mort, 3 = obstacle vivant\n";
+    std::cout << "  Les fichiers .mc sont lus au format macrocell (arbre quaternaire)\n\n";
     std::cout << "Exemple:\n";
     std::cout << "  5 10\n";
     std::cout << "  0 0 1 0 0 0 0 0 0 0\n";
@@ -37,6 +150,198 @@ void printUsage(const char* programName) {
     std::cout << "  0 0 0 0 0 0 0 0 0 0\n";
 }
 
+/**
+ * @brief Exécute la simulation hors mémoire (grille stockée sur disque par bandes)
+ * @return Code de retour du programme
+ */
+int runOutOfCore(const std::string& inputFile, int iterations, bool toroidal, int bandRows,
+                 const std::string& outputExtension) {
+    try {
+        std::cout << "Chargement de la grille (hors mémoire) depuis: " << inputFile << "\n";
+        
+        // Les bandes sont stockées à côté du dossier de sortie
+        std::string outputDir = FileHandler::createOutputDirectory(inputFile);
+        std::string storage = outputDir + "/grid";
+        std::unique_ptr<BandedGrid> grid;
+        {
+            ScopedTimer timer(Metrics::Phase::FileLoad);
+            grid = FileHandler::loadBandedGrid(inputFile, storage, toroidal, bandRows);
+        }
+        std::cout << "Grille chargée: " << grid->getWidth() << "x" << grid->getHeight()
+                  << " (" << grid->getBandCount() << " bandes de " << grid->getBandRows() << " lignes)";
+        if (toroidal) std::cout << " (mode torique)";
+        std::cout << "\n";
+        std::cout << "Dossier de sortie: " << outputDir << "\n";
+        
+        OutOfCoreGame game(std::move(grid), std::make_unique<ClassicRule>(), iterations);
+        auto saveIteration = [&](int iter) {
+            ScopedTimer timer(Metrics::Phase::FileSave);
+            FileHandler::saveToFile(game.getGrid(), FileHandler::getIterationFilename(outputDir, iter, outputExtension));
+        };
+        saveIteration(0);
+        
+        std::cout << "\nDémarrage de la simulation...\n";
+        
+        while (game.step()) {
+            int iter = game.getIteration();
+            saveIteration(iter);
+            
+            if (iter % 10 == 0) {
+                std::cout << "Itération " << iter << " (" << game.countAliveCells() << " vivantes)...\n";
+            }
+        }
+        
+        if (game.isStable()) {
+            std::cout << "\nL'automate est stable à l'itération " << game.getIteration() << ".\n";
+        }
+        std::cout << "\nSimulation terminée après " << game.getIteration() << " itérations.\n";
+        std::cout << "Résultats sauvegardés dans: " << outputDir << "\n";
+        
+    } catch (const std::exception& e) {
+        std::cerr << "Erreur: " << e.what() << "\n";
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief Exécute un lot de simulations réparties sur tous les cœurs
+ * @return Code de retour du programme (1 si au moins un fichier a échoué)
+ */
+int runBatch(const std::string& source, const BatchOptions& options, const std::string& summaryFile) {
+    try {
+        std::vector<std::string> inputs = BatchRunner::collectInputs(source);
+        if (inputs.empty()) {
+            std::cerr << "Erreur: Aucun fichier d'entrée dans " << source << "\n";
+            return 1;
+        }
+        std::cout << "Mode lot: " << inputs.size() << " fichiers depuis " << source << "\n\n";
+        
+        auto start = std::chrono::steady_clock::now();
+        BatchRunner runner(options);
+        auto results = runner.run(inputs, [](const BatchResult& result, size_t done, size_t total) {
+            std::cout << "[" << done << "/" << total << "] " << result.inputFile << ": ";
+            if (!result.success) {
+                std::cout << "erreur (" << result.error << ")\n";
+            } else {
+                std::cout << result.finalGeneration << " itérations, " << result.population << " vivantes";
+                if (result.period == 1) std::cout << ", stable";
+                else if (result.period > 1) std::cout << ", période " << result.period;
+                std::cout << "\n";
+            }
+        });
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        
+        std::ofstream summary(summaryFile);
+        if (!summary.is_open()) {
+            std::cerr << "Erreur: Impossible de créer " << summaryFile << "\n";
+            return 1;
+        }
+        BatchRunner::writeSummary(results, summary);
+        
+        size_t failures = std::count_if(results.begin(), results.end(),
+                                        [](const BatchResult& result) { return !result.success; });
+        std::cout << "\nLot terminé en " << seconds << " s (" << results.size() - failures << " réussis, "
+                  << failures << " en échec).\n";
+        std::cout << "Récapitulatif: " << summaryFile << "\n";
+        return failures == 0 ? 0 : 1;
+        
+    } catch (const std::exception& e) {
+        std::cerr << "Erreur: " << e.what() << "\n";
+        return 1;
+    }
+}
+
+/**
+ * @brief Mode --tune : mesure les stratégies de mise à jour et enregistre la plus rapide
+ * @param options Taille, densité, graine et topologie de la charge à régler
+ * @param maxThreads Nombre maximal de threads essayés (0 = nombre de cœurs)
+ */
+int runTuning(const SoupOptions& options, unsigned int maxThreads) {
+    try {
+        AutoTuner tuner(options.width, options.height, options.density, options.toroidal, options.seed);
+        std::string profilePath = TuningProfile::defaultPath();
+        std::cout << "Réglage: grille " << options.width << "x" << options.height
+                  << ", densité " << options.density;
+        if (options.toroidal) std::cout << " (mode torique)";
+        std::cout << "\n\n";
+        
+        auto measured = tuner.run(0.6, [](const TuningConfig& config) {
+            std::cout << "  " << config.describe() << ": "
+                      << static_cast<long long>(config.cellsPerSecond) << " cellules/s\n";
+        }, maxThreads);
+        TuningConfig best = AutoTuner::best(measured);
+        
+        TuningProfile profile = TuningProfile::load(profilePath);
+        profile.set(options.width, options.height, options.density, options.toroidal, best);
+        profile.save(profilePath);
+        std::cout << "\nStratégie retenue: " << best.describe() << " ("
+                  << static_cast<long long>(best.cellsPerSecond) << " cellules/s)\n";
+        std::cout << "Profil mis à jour: " << profilePath << "\n";
+    } catch (const std::exception& e) {
+        std::cerr << "Erreur: " << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
+
+/**
+ * @brief Simule un ensemble de soupes aléatoires et affiche les statistiques
+ * @return Code de retour du programme
+ */
+int runSoups(const SoupOptions& options, const std::string& csvFile) {
+    try {
+        SoupRunner runner(options);
+        std::cout << "Soupes: " << options.count << " grilles " << options.width << "x" << options.height
+                  << ", densité " << options.density << ", graine " << options.seed;
+        if (options.toroidal) std::cout << " (mode torique)";
+        std::cout << "\n";
+        
+        std::ofstream csv;
+        if (!csvFile.empty()) {
+            csv.open(csvFile);
+            if (!csv.is_open()) {
+                std::cerr << "Erreur: Impossible de créer " << csvFile << "\n";
+                return 1;
+            }
+            csv << "soup,initial_population,lifespan,final_population,period\n";
+        }
+        
+        auto start = std::chrono::steady_clock::now();
+        SoupStatistics stats = runner.run([&csv](const SoupResult& result) {
+            if (csv.is_open()) {
+                csv << result.index << ',' << result.initialPopulation << ',' << result.lifespan << ','
+                    << result.finalPopulation << ',' << result.period << '\n';
+            }
+        });
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        
+        std::cout << "\nSoupes simulées: " << stats.soups << " en " << seconds << " s ("
+                  << (seconds > 0 ? stats.soups / seconds : 0.0) << " soupes/s)\n";
+        std::cout << "Stabilisées: " << stats.settled << " (non stabilisées après "
+                  << options.maxGenerations << " générations: " << stats.soups - stats.settled << ")\n";
+        std::cout << "Durée de vie moyenne: " << stats.meanLifespan() << " générations\n";
+        std::cout << "Durée de vie maximale: " << stats.maxLifespan << " (soupe " << stats.maxLifespanSoup << ")\n";
+        std::cout << "Population finale moyenne: " << stats.meanFinalPopulation() << "\n";
+        std::cout << "Périodes finales:\n";
+        for (const auto& entry : stats.periodCounts) {
+            if (entry.first == 0) std::cout << "  aucune: ";
+            else std::cout << "  " << entry.first << ": ";
+            std::cout << entry.second << "\n";
+        }
+        if (!csvFile.empty()) {
+            std::cout << "Résultats par soupe: " << csvFile << "\n";
+        }
+        
+    } catch (const std::exception& e) {
+        std::cerr << "Erreur: " << e.what() << "\n";
+        return 1;
+    }
+    
+    return 0;
+}
+
 int main(int argc, char* argv[]) {
     // Paramètres par défaut
     std::string inputFile;
@@ -44,6 +349,24 @@ int main(int argc, char* argv[]) {
     bool toroidal = false;
     bool parallel = false;
     bool verbose = false;
+    std::string archiveFile;
+    int keyframeInterval = 64;
+    int bandRows = 0;  // 0 = grille en mémoire
+    int checkpointInterval = 0;  // 0 = pas de point de contrôle
+    std::string checkpointDir;
+    bool resume = false;
+    std::string outputExtension = ".txt";
+    std::string batchSource;
+    std::string summaryFile;
+    int batchThreads = 0;  // 0 = nombre de cœurs
+    bool iterationsGiven = false;
+    long long soupCount = 0;
+    SoupOptions soupOptions;
+    std::string metricsFile;
+    std::string traceFile;
+    int metricsPort = -1;  // -1 = pas de point d'accès
+    bool tune = false;
+    bool sizeGiven = false;
     
     // Parse des arguments
     for (int i = 1; i < argc; ++i) {
@@ -54,12 +377,65 @@ int main(int argc, char* argv[]) {
             return 0;
         } else if (arg == "-n" && i + 1 < argc) {
             iterations = std::atoi(argv[++i]);
+            iterationsGiven = true;
         } else if (arg == "-t") {
             toroidal = true;
         } else if (arg == "-p") {
             parallel = true;
         } else if (arg == "-v") {
             verbose = true;
+        } else if (arg == "-a" && i + 1 < argc) {
+            archiveFile = argv[++i];
+        } else if (arg == "-k" && i + 1 < argc) {
+            keyframeInterval = std::atoi(argv[++i]);
+            if (keyframeInterval < 1) keyframeInterval = 1;
+        } else if (arg == "-b" && i + 1 < argc) {
+            bandRows = std::atoi(argv[++i]);
+            if (bandRows < 1) bandRows = 1;
+        } else if (arg == "-f" && i + 1 < argc) {
+            std::string format = argv[++i];
+            if (format != "txt" && format != "mc") {
+                std::cerr << "Format inconnu: " << format << " (txt ou mc)\n";
+                return 1;
+            }
+            outputExtension = "." + format;
+        } else if (arg == "-c" && i + 1 < argc) {
+            checkpointInterval = std::atoi(argv[++i]);
+        } else if (arg == "--checkpoint-dir" && i + 1 < argc) {
+            checkpointDir = argv[++i];
+        } else if (arg == "--resume") {
+            resume = true;
+        } else if (arg == "--batch" && i + 1 < argc) {
+            batchSource = argv[++i];
+        } else if (arg == "-j" && i + 1 < argc) {
+            batchThreads = std::atoi(argv[++i]);
+            if (batchThreads < 0) batchThreads = 0;
+        } else if (arg == "--summary" && i + 1 < argc) {
+            summaryFile = argv[++i];
+        } else if (arg == "--soups" && i + 1 < argc) {
+            soupCount = std::atoll(argv[++i]);
+        } else if (arg == "--size" && i + 1 < argc) {
+            std::string size = argv[++i];
+            size_t separator = size.find('x');
+            if (separator == std::string::npos) {
+                std::cerr << "Taille invalide: " << size << " (attendu: <largeur>x<hauteur>)\n";
+                return 1;
+            }
+            soupOptions.width = std::atoi(size.substr(0, separator).c_str());
+            soupOptions.height = std::atoi(size.substr(separator + 1).c_str());
+            sizeGiven = true;
+        } else if (arg == "--density" && i + 1 < argc) {
+            soupOptions.density = std::atof(argv[++i]);
+        } else if (arg == "--seed" && i + 1 < argc) {
+            soupOptions.seed = std::strtoull(argv[++i], nullptr, 10);
+        } else if (arg == "--metrics" && i + 1 < argc) {
+            metricsFile = argv[++i];
+        } else if (arg == "--trace" && i + 1 < argc) {
+            traceFile = argv[++i];
+        } else if (arg == "--tune") {
+            tune = true;
+        } else if (arg == "--metrics-port" && i + 1 < argc) {
+            metricsPort = std::atoi(argv[++i]);
         } else if (arg[0] != '-') {
             inputFile = arg;
         } else {
@@ -69,6 +445,50 @@ int main(int argc, char* argv[]) {
         }
     }
     
+    if (!metricsFile.empty()) {
+        Metrics::setEnabled(true);
+#ifdef SIGUSR1
+        std::signal(SIGUSR1, requestMetrics);
+#endif
+    }
+    
+    if (!traceFile.empty()) {
+        Tracer::setThreadName("main");
+        Tracer::instance().start();
+    }
+    
+    if (!batchSource.empty()) {
+        BatchOptions options;
+        options.iterations = iterations;
+        options.toroidal = toroidal;
+        options.outputExtension = outputExtension;
+        options.threadCount = static_cast<unsigned int>(batchThreads);
+        int status = runBatch(batchSource, options, summaryFile.empty() ? "batch_summary.csv" : summaryFile);
+        writeMetrics(metricsFile);
+        writeTrace(traceFile);
+        return status;
+    }
+    
+    if (tune) {
+        if (!sizeGiven) {
+            soupOptions.width = 256;
+            soupOptions.height = 256;
+        }
+        soupOptions.toroidal = toroidal;
+        return runTuning(soupOptions, static_cast<unsigned int>(batchThreads));
+    }
+    
+    if (soupCount > 0) {
+        soupOptions.count = soupCount;
+        soupOptions.toroidal = toroidal;
+        soupOptions.threadCount = static_cast<unsigned int>(batchThreads);
+        if (iterationsGiven) soupOptions.maxGenerations = iterations;
+        int status = runSoups(soupOptions, summaryFile);
+        writeMetrics(metricsFile);
+        writeTrace(traceFile);
+        return status;
+    }
+    
     // Vérifie qu'un fichier a été fourni
     if (inputFile.empty()) {
         std::cerr << "Erreur: Aucun fichier d'entrée spécifié.\n\n";
@@ -76,11 +496,46 @@ int main(int argc, char* argv[]) {
         return 1;
     }
     
+    if (bandRows > 0) {
+        if (!archiveFile.empty() || parallel || verbose || metricsPort >= 0) {
+            std::cerr << "Avertissement: -a, -p, -v et --metrics-port sont ignorés en mode hors mémoire.\n";
+        }
+        int status = runOutOfCore(inputFile, iterations, toroidal, bandRows, outputExtension);
+        writeMetrics(metricsFile);
+        writeTrace(traceFile);
+        return status;
+    }
+    
+    if (resume && !archiveFile.empty()) {
+        std::cerr << "Erreur: --resume n'est pas compatible avec -a (archive).\n";
+        return 1;
+    }
+    if (checkpointDir.empty()) {
+        checkpointDir = FileHandler::getBaseName(inputFile) + "_ckpt";
+    }
+    
     try {
-        std::cout << "Chargement de la grille depuis: " << inputFile << "\n";
+        // Recherche d'un point de contrôle pour la reprise
+        CheckpointData checkpoint;
+        std::string checkpointFile;
+        if (resume) {
+            checkpointFile = Checkpoint::loadLatest(checkpointDir, checkpoint);
+            if (checkpointFile.empty()) {
+                std::cout << "Aucun point de contrôle dans " << checkpointDir << ", démarrage depuis le début.\n";
+            }
+        }
         
         // Charge la grille
-        auto grid = FileHandler::loadFromFile(inputFile, toroidal);
+        std::unique_ptr<Grid> grid;
+        if (!checkpointFile.empty()) {
+            std::cout << "Reprise depuis: " << checkpointFile << " (itération " << checkpoint.iteration << ")\n";
+            grid = std::make_unique<Grid>(checkpoint.width, checkpoint.height, checkpoint.cells, checkpoint.toroidal);
+            toroidal = checkpoint.toroidal;
+        } else {
+            std::cout << "Chargement de la grille depuis: " << inputFile << "\n";
+            ScopedTimer timer(Metrics::Phase::FileLoad);
+            grid = FileHandler::loadFromFile(inputFile, toroidal);
+        }
         std::cout << "Grille chargée: " << grid->getWidth() << "x" << grid->getHeight();
         if (toroidal) std::cout << " (mode torique)";
         std::cout << "\n";
@@ -89,18 +544,68 @@ int main(int argc, char* argv[]) {
         auto rule = std::make_unique<ClassicRule>();
         Game game(std::move(grid), std::move(rule), iterations);
         game.setParallel(parallel);
+        if (!parallel && game.applyTuning(TuningProfile::loadDefault())) {
+            TuningConfig applied;
+            applied.parallel = game.isParallel();
+            applied.threads = game.getThreadCount();
+            applied.bandRows = game.getBandRows();
+            std::cout << "Stratégie du profil de réglage: " << applied.describe() << "\n";
+        }
+        if (!checkpointFile.empty()) {
+            Checkpoint::restore(checkpoint, game);
+        }
         
-        // Crée le dossier de sortie
-        std::string outputDir = FileHandler::createOutputDirectory(inputFile);
-        std::cout << "Dossier de sortie: " << outputDir << "\n";
+        // Crée le dossier de sortie ou l'archive
+        std::string outputDir;
+        std::unique_ptr<ArchiveWriter> archive;
+        if (!archiveFile.empty()) {
+            archive = std::make_unique<ArchiveWriter>(archiveFile, game.getGrid().getWidth(),
+                                                      game.getGrid().getHeight(), toroidal,
+                                                      keyframeInterval);
+            std::cout << "Archive de sortie: " << archiveFile << "\n";
+        } else {
+            outputDir = FileHandler::createOutputDirectory(inputFile);
+            std::cout << "Dossier de sortie: " << outputDir << "\n";
+        }
         
-        // Sauvegarde l'état initial
-        std::string filename = FileHandler::getIterationFilename(outputDir, 0);
-        FileHandler::saveToFile(game.getGrid(), filename);
+        // Sauvegarde une génération dans l'archive ou dans le dossier de sortie
+        auto saveIteration = [&](int iter) {
+            ScopedTimer timer(Metrics::Phase::FileSave);
+            if (archive) {
+                archive->append(game.getGrid());
+            } else {
+                FileHandler::saveToFile(game.getGrid(),
+                                        FileHandler::getIterationFilename(outputDir, iter, outputExtension));
+            }
+        };
         
-        if (verbose) {
-            std::cout << "\n=== Itération 0 ===\n";
-            std::cout << game.getGrid().toString() << "\n";
+        // Points de contrôle écrits en arrière-plan : la simulation n'attend jamais le disque
+        AsyncWriter checkpointWriter;
+        int lastCheckpoint = game.getIteration();
+        if (checkpointInterval > 0) {
+            std::filesystem::create_directories(checkpointDir);
+            std::cout << "Points de contrôle: " << checkpointDir << " (toutes les "
+                      << checkpointInterval << " itérations)\n";
+        }
+        
+        // Sauvegarde l'état initial (déjà fait lors d'une reprise)
+        if (game.getIteration() == 0) {
+            saveIteration(0);
+            
+            if (verbose) {
+                std::cout << "\n=== Itération 0 ===\n";
+                std::cout << game.getGrid().toString() << "\n";
+            }
+        }
+        
+        // Point d'accès de supervision (Prometheus)
+        StatsServer statsServer;
+        const long long cellCount = static_cast<long long>(game.getGrid().getWidth()) * game.getGrid().getHeight();
+        if (metricsPort >= 0) {
+            statsServer.start(metricsPort);
+            statsServer.publishGeneration(game.getIteration(), cellCount);
+            publishPopulation(statsServer, game.getGrid(), game.getIteration());
+            std::cout << "Métriques en direct: http://127.0.0.1:" << statsServer.getPort() << "/metrics\n";
         }
         
         // Exécute la simulation
@@ -108,8 +613,24 @@ int main(int argc, char* argv[]) {
         
         while (game.step()) {
             int iter = game.getIteration();
-            filename = FileHandler::getIterationFilename(outputDir, iter);
-            FileHandler::saveToFile(game.getGrid(), filename);
+            auto writeStart = std::chrono::steady_clock::now();
+            saveIteration(iter);
+            
+            if (statsServer.isRunning()) {
+                statsServer.publishGeneration(iter, cellCount);
+                statsServer.setOutputWriteSeconds(std::chrono::duration<double>(
+                    std::chrono::steady_clock::now() - writeStart).count());
+                statsServer.setCheckpointQueueDepth(static_cast<long long>(checkpointWriter.pending()));
+                if (statsServer.takePopulationRequest()) {
+                    publishPopulation(statsServer, game.getGrid(), iter);
+                }
+            }
+            
+            if (g_metricsRequested) {
+                g_metricsRequested = 0;
+                writeMetrics(metricsFile);
+                std::cout << "Métriques écrites dans " << metricsFile << " (itération " << iter << ")\n";
+            }
             
             if (verbose) {
                 std::cout << "\n=== Itération " << iter << " ===\n";
@@ -123,16 +644,51 @@ int main(int argc, char* argv[]) {
                 std::cout << "\nL'automate est stable à l'itération " << iter << ".\n";
                 break;
             }
+            
+            // Point de contrôle : reporté tant que le précédent est en cours d'écriture
+            if (checkpointInterval > 0 && iter - lastCheckpoint >= checkpointInterval &&
+                checkpointWriter.pending() == 0) {
+                auto data = std::make_shared<CheckpointData>(Checkpoint::capture(game));
+                checkpointWriter.submit([data, checkpointDir]() {
+                    Checkpoint::write(*data, Checkpoint::getCheckpointFilename(checkpointDir, data->iteration));
+                    Checkpoint::prune(checkpointDir, 2);
+                });
+                lastCheckpoint = iter;
+                
+                std::string error = checkpointWriter.takeError();
+                if (!error.empty()) {
+                    std::cerr << "Erreur de point de contrôle: " << error << "\n";
+                }
+            }
+        }
+        
+        checkpointWriter.flush();
+        std::string checkpointError = checkpointWriter.takeError();
+        if (!checkpointError.empty()) {
+            std::cerr << "Erreur de point de contrôle: " << checkpointError << "\n";
         }
         
         std::cout << "\nSimulation terminée après " << game.getIteration() << " itérations.\n";
-        std::cout << "Résultats sauvegardés dans: " << outputDir << "\n";
+        if (archive) {
+            archive->close();
+            std::cout << "Résultats sauvegardés dans: " << archiveFile
+                      << " (" << archive->getGenerationCount() << " générations)\n";
+        } else {
+            std::cout << "Résultats sauvegardés dans: " << outputDir << "\n";
+        }
         
     } catch (const std::exception& e) {
         std::cerr << "Erreur: " << e.what() << "\n";
+        writeMetrics(metricsFile);
+        writeTrace(traceFile);
         return 1;
     }
     
+    writeMetrics(metricsFile);
+    writeTrace(traceFile);
+    if (!metricsFile.empty()) {
+        std::cout << "Métriques: " << metricsFile << "\n";
+    }
     return 0;
 }
 
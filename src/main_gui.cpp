@@ -6,14 +6,19 @@
  * et interagir avec le Jeu de la Vie.
  */
 
+#include <fstream>
 #include <iostream>
 #include <string>
 #include <cstdlib>
+#include <algorithm>
 #include "game/Game.hpp"
 #include "grid/Grid.hpp"
 #include "rules/ClassicRule.hpp"
 #include "io/FileHandler.hpp"
+#include "io/GenerationArchive.hpp"
+#include "game/AutoTuner.hpp"
 #include "gui/GUIController.hpp"
+#include "util/Tracer.hpp"
 
 void printUsage(const char* programName) {
     std::cout << "Jeu de la Vie - Mode Graphique\n";
@@ -26,6 +31,9 @@ void printUsage(const char* programName) {
     std::cout << "  -w <largeur>   Largeur de la fenetre (defaut: auto)\n";
     std::cout << "  -h <hauteur>   Hauteur de la fenetre (defaut: auto)\n";
     std::cout << "  -t             Activer le mode torique\n";
+    std::cout << "  --gen <n>      Generation a ouvrir dans une archive .gola (defaut: derniere)\n";
+    std::cout << "  --trace <f>    Ecrire une trace Chrome/Perfetto (JSON) a la fermeture\n";
+    std::cout << "  --turbo <n>    Demarrer en mode turbo a n generations/s (0 = maximum)\n";
     std::cout << "  --help         Afficher cette aide\n";
 }
 
@@ -38,6 +46,9 @@ int main(int argc, char* argv[]) {
     int windowWidth = 0;   // Auto
     int windowHeight = 0;  // Auto
     bool toroidal = false;
+    int archiveGeneration = -1;  // -1 = dernière génération
+    std::string traceFile;
+    int turboRate = -1;    // -1 = turbo désactivé
     
     // Parse des arguments
     for (int i = 1; i < argc; ++i) {
@@ -58,8 +69,8 @@ int main(int argc, char* argv[]) {
                 gridHeight = std::atoi(sizeStr.substr(xPos + 1).c_str());
                 if (gridWidth < 10) gridWidth = 10;
                 if (gridHeight < 10) gridHeight = 10;
-                if (gridWidth > 200) gridWidth = 200;
-                if (gridHeight > 200) gridHeight = 200;
+                if (gridWidth > GUIController::MAX_GRID_SIZE) gridWidth = GUIController::MAX_GRID_SIZE;
+                if (gridHeight > GUIController::MAX_GRID_SIZE) gridHeight = GUIController::MAX_GRID_SIZE;
             }
         } else if (arg == "-w" && i + 1 < argc) {
             windowWidth = std::atoi(argv[++i]);
@@ -67,16 +78,37 @@ int main(int argc, char* argv[]) {
             windowHeight = std::atoi(argv[++i]);
         } else if (arg == "-t") {
             toroidal = true;
+        } else if (arg == "--gen" && i + 1 < argc) {
+            archiveGeneration = std::atoi(argv[++i]);
+        } else if (arg == "--trace" && i + 1 < argc) {
+            traceFile = argv[++i];
+        } else if (arg == "--turbo" && i + 1 < argc) {
+            turboRate = std::max(0, std::atoi(argv[++i]));
         } else if (arg[0] != '-') {
             inputFile = arg;
         }
     }
     
+    if (!traceFile.empty()) {
+        Tracer::setThreadName("main");
+        Tracer::instance().start();
+    }
+    
     try {
         std::unique_ptr<Grid> grid;
         
         // Charge ou crée la grille
-        if (!inputFile.empty()) {
+        if (!inputFile.empty() && FileHandler::getExtension(inputFile) == ".gola") {
+            // Archive de simulation : accès direct à la génération demandée
+            ArchiveReader archive(inputFile);
+            int last = archive.getGenerationCount() - 1;
+            int generation = (archiveGeneration < 0 || archiveGeneration > last) ? last : archiveGeneration;
+            std::cout << "Ouverture de l'archive: " << inputFile << " (generation " << generation
+                      << "/" << last << ")\n";
+            grid = archive.readGeneration(generation);
+            grid->setToroidal(toroidal || archive.isToroidal());
+            toroidal = grid->isToroidal();
+        } else if (!inputFile.empty()) {
             std::cout << "Chargement de la grille depuis: " << inputFile << "\n";
             grid = FileHandler::loadFromFile(inputFile, toroidal);
         } else {
@@ -106,11 +138,28 @@ int main(int argc, char* argv[]) {
         // Crée le jeu
         auto rule = std::make_unique<ClassicRule>();
         Game game(std::move(grid), std::move(rule), 0);
+        if (game.applyTuning(TuningProfile::loadDefault())) {
+            std::cout << "Profil de reglage applique: " << (game.isParallel() ? "parallele" : "sequentiel") << "\n";
+        }
         
         // Lance l'interface graphique
         GUIController controller(game, windowWidth, windowHeight, cellSize);
+        if (turboRate >= 0) {
+            controller.enableTurbo(turboRate);
+        }
         controller.run();
         
+        if (!traceFile.empty()) {
+            Tracer::instance().stop();
+            std::ofstream trace(traceFile);
+            if (trace.is_open()) {
+                Tracer::instance().writeJson(trace);
+                std::cout << "Trace: " << traceFile << "\n";
+            } else {
+                std::cerr << "Erreur: Impossible d'ecrire la trace dans " << traceFile << "\n";
+            }
+        }
+        
     } catch (const std::exception& e) {
         std::cerr << "Erreur: " << e.what() << "\n";
         return 1;
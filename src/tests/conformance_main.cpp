@@ -0,0 +1,330 @@
+/**
+ * @file conformance_main.cpp
+ * @brief Vérification différentielle des moteurs de simulation
+ *
+ * Simule les mêmes grilles (fichiers d'exemple et soupes aléatoires, planes et toriques,
+ * avec ou sans obstacles) avec chaque moteur disponible et chaque nombre de threads, et
+ * compare toutes les générations à un moteur de référence volontairement naïf. La première
+ * cellule différente est signalée avec le moteur, la génération et les deux états.
+ */
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <memory>
+#include <cstdlib>
+#include <cstdint>
+#include <filesystem>
+#include "grid/Grid.hpp"
+#include "grid/BandedGrid.hpp"
+#include "game/Game.hpp"
+#include "game/BatchRunner.hpp"
+#include "rules/ClassicRule.hpp"
+#include "io/FileHandler.hpp"
+#include "util/CounterRng.hpp"
+
+/**
+ * @brief Grille de départ d'un cas de conformité
+ */
+struct ConformanceCase {
+    std::string name;
+    int width;
+    int height;
+    bool toroidal;
+    std::vector<std::uint8_t> codes;    ///< Codes ligne par ligne (0 à 3)
+};
+
+/**
+ * @brief Moteur de simulation comparé à la référence
+ */
+class Engine {
+public:
+    virtual ~Engine() = default;
+    virtual std::string getName() const = 0;
+    virtual void step(const Rule& rule) = 0;
+    virtual std::vector<std::uint8_t> getCodes() const = 0;
+};
+
+/**
+ * @brief Grid::update, séquentiel ou parallèle (bandes fixes ou distribuées dynamiquement)
+ */
+class GridEngine : public Engine {
+private:
+    Grid m_grid;
+    unsigned int m_threads;
+    int m_bandRows;
+
+public:
+    GridEngine(const ConformanceCase& c, unsigned int threads, int bandRows = 0)
+        : m_grid(c.width, c.height, c.codes, c.toroidal)
+        , m_threads(threads)
+        , m_bandRows(bandRows)
+    {
+    }
+
+    std::string getName() const override {
+        if (m_threads == 0) return "Grid séquentiel";
+        std::string name = "Grid parallèle " + std::to_string(m_threads) + " threads";
+        if (m_bandRows > 0) name += ", bandes de " + std::to_string(m_bandRows) + " lignes";
+        return name;
+    }
+    void step(const Rule& rule) override { m_grid.update(rule, m_threads > 0, m_threads, m_bandRows); }
+    std::vector<std::uint8_t> getCodes() const override { return m_grid.toCodes(); }
+};
+
+/**
+ * @brief Game::step (copie de la grille précédente, détection de stabilité)
+ */
+class GameEngine : public Engine {
+private:
+    Game m_game;
+
+public:
+    GameEngine(const ConformanceCase& c, unsigned int threads)
+        : m_game(std::make_unique<Grid>(c.width, c.height, c.codes, c.toroidal), std::make_unique<ClassicRule>())
+    {
+        m_game.setParallel(threads > 0);
+        m_game.setThreadCount(threads);
+    }
+
+    std::string getName() const override {
+        return m_game.getThreadCount() == 0 ? "Game séquentiel"
+                                            : "Game parallèle " + std::to_string(m_game.getThreadCount()) + " threads";
+    }
+    // Game s'arrête sur une grille stable : la grille ne change alors plus, comme la référence
+    void step(const Rule&) override { m_game.step(); }
+    std::vector<std::uint8_t> getCodes() const override { return m_game.getGrid().toCodes(); }
+};
+
+/**
+ * @brief BandedGrid (hors mémoire, bandes sur disque)
+ */
+class BandedEngine : public Engine {
+private:
+    BandedGrid m_grid;
+    int m_width;
+
+public:
+    BandedEngine(const ConformanceCase& c, const std::string& storage, int bandRows)
+        : m_grid(storage, c.width, c.height, c.toroidal, bandRows)
+        , m_width(c.width)
+    {
+        m_grid.importRows([&c](int y, std::uint8_t* row) {
+            std::copy(c.codes.begin() + static_cast<size_t>(y) * c.width,
+                      c.codes.begin() + static_cast<size_t>(y + 1) * c.width, row);
+        });
+    }
+
+    std::string getName() const override {
+        return "BandedGrid bandes de " + std::to_string(m_grid.getBandRows()) + " lignes";
+    }
+    void step(const Rule& rule) override { m_grid.step(rule); }
+    std::vector<std::uint8_t> getCodes() const override {
+        std::vector<std::uint8_t> codes(static_cast<size_t>(m_width) * m_grid.getHeight());
+        m_grid.exportRows([this, &codes](int y, const std::uint8_t* row) {
+            std::copy(row, row + m_width, codes.begin() + static_cast<size_t>(y) * m_width);
+        });
+        return codes;
+    }
+};
+
+/**
+ * @brief Génération suivante calculée naïvement (référence)
+ *
+ * Mêmes conventions que Grid : en mode torique, chacun des 8 voisins est ramené dans la
+ * grille (un même voisin peut compter plusieurs fois sur une grille de largeur ou hauteur < 3).
+ */
+std::vector<std::uint8_t> referenceStep(const std::vector<std::uint8_t>& codes, int width, int height,
+                                        bool toroidal, const Rule& rule) {
+    std::vector<std::uint8_t> next(codes.size());
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            std::uint8_t code = codes[static_cast<size_t>(y) * width + x];
+            if (code >= 2) {
+                next[static_cast<size_t>(y) * width + x] = code;
+                continue;
+            }
+            int neighbors = 0;
+            for (int dy = -1; dy <= 1; ++dy) {
+                for (int dx = -1; dx <= 1; ++dx) {
+                    if (dx == 0 && dy == 0) continue;
+                    int nx = x + dx;
+                    int ny = y + dy;
+                    if (toroidal) {
+                        nx = (nx % width + width) % width;
+                        ny = (ny % height + height) % height;
+                    } else if (nx < 0 || nx >= width || ny < 0 || ny >= height) {
+                        continue;
+                    }
+                    neighbors += codes[static_cast<size_t>(ny) * width + nx] & 1;
+                }
+            }
+            next[static_cast<size_t>(y) * width + x] = rule.computeNextState(code == 1, neighbors)->isAlive() ? 1 : 0;
+        }
+    }
+    return next;
+}
+
+/**
+ * @brief Soupe aléatoire reproductible
+ */
+ConformanceCase makeRandomCase(std::uint64_t seed, int index, int width, int height, bool toroidal,
+                               double density, double obstacles) {
+    ConformanceCase c{"soupe " + std::to_string(index), width, height, toroidal, {}};
+    c.codes.resize(static_cast<size_t>(width) * height);
+    const std::uint64_t aliveThreshold = static_cast<std::uint64_t>(density * 4294967296.0);
+    const std::uint64_t obstacleThreshold = static_cast<std::uint64_t>(obstacles * 4294967296.0);
+    CounterRng rng(seed, static_cast<std::uint64_t>(index));
+    for (auto& code : c.codes) {
+        bool obstacle = rng.next() < obstacleThreshold;
+        bool alive = rng.next() < aliveThreshold;
+        code = static_cast<std::uint8_t>((obstacle ? 2 : 0) + (alive ? 1 : 0));
+    }
+    return c;
+}
+
+/**
+ * @brief Simule un cas avec tous les moteurs
+ * @return true si tous les moteurs suivent la référence à chaque génération
+ */
+bool runCase(const ConformanceCase& c, int generations, const std::vector<unsigned int>& threadCounts,
+             const std::vector<int>& bandSizes) {
+    ClassicRule rule;
+    std::string storage = (std::filesystem::temp_directory_path() / "gameoflife_conformance").string();
+
+    std::vector<std::unique_ptr<Engine>> engines;
+    engines.push_back(std::make_unique<GridEngine>(c, 0));
+    for (unsigned int threads : threadCounts) {
+        engines.push_back(std::make_unique<GridEngine>(c, threads));
+    }
+    engines.push_back(std::make_unique<GridEngine>(c, 3, 1));
+    engines.push_back(std::make_unique<GridEngine>(c, 4, 5));
+    engines.push_back(std::make_unique<GameEngine>(c, 0));
+    engines.push_back(std::make_unique<GameEngine>(c, threadCounts.empty() ? 0 : threadCounts.back()));
+    for (size_t i = 0; i < bandSizes.size(); ++i) {
+        engines.push_back(std::make_unique<BandedEngine>(c, storage + std::to_string(i), bandSizes[i]));
+    }
+
+    std::cout << c.name << " (" << c.width << "x" << c.height << (c.toroidal ? ", torique" : "")
+              << ", " << engines.size() << " moteurs)... ";
+    std::cout.flush();
+
+    std::vector<std::uint8_t> expected = c.codes;
+    for (int generation = 1; generation <= generations; ++generation) {
+        expected = referenceStep(expected, c.width, c.height, c.toroidal, rule);
+        for (auto& engine : engines) {
+            engine->step(rule);
+            std::vector<std::uint8_t> actual = engine->getCodes();
+            if (actual == expected) continue;
+
+            for (size_t i = 0; i < expected.size(); ++i) {
+                if (actual[i] != expected[i]) {
+                    std::cout << "DIVERGENCE\n"
+                              << "  moteur: " << engine->getName() << "\n"
+                              << "  génération: " << generation << "\n"
+                              << "  première cellule: (" << i % c.width << ", " << i / c.width << ")"
+                              << " attendu " << static_cast<int>(expected[i])
+                              << ", obtenu " << static_cast<int>(actual[i]) << "\n";
+                    break;
+                }
+            }
+            return false;
+        }
+    }
+    std::cout << "OK (" << generations << " générations)\n";
+    return true;
+}
+
+void printUsage(const char* programName) {
+    std::cout << "Jeu de la Vie - Conformité des moteurs\n";
+    std::cout << "======================================\n\n";
+    std::cout << "Usage: " << programName << " [options]\n\n";
+    std::cout << "Options:\n";
+    std::cout << "  -n <nombre>         Générations par cas (défaut: 2000)\n";
+    std::cout << "  --cases <nombre>    Nombre de soupes aléatoires (défaut: 12)\n";
+    std::cout << "  --seed <s>          Graine des soupes (défaut: 1)\n";
+    std::cout << "  --examples <dossier> Dossier des fichiers d'exemple (défaut: examples)\n";
+    std::cout << "  --quick             Vérification rapide (200 générations, 4 soupes)\n";
+    std::cout << "  -h                  Afficher cette aide\n";
+}
+
+int main(int argc, char* argv[]) {
+    int generations = 2000;
+    int randomCases = 12;
+    std::uint64_t seed = 1;
+    std::string examplesDir = "examples";
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "-h" || arg == "--help") {
+            printUsage(argv[0]);
+            return 0;
+        } else if (arg == "-n" && i + 1 < argc) {
+            generations = std::atoi(argv[++i]);
+        } else if (arg == "--cases" && i + 1 < argc) {
+            randomCases = std::atoi(argv[++i]);
+        } else if (arg == "--seed" && i + 1 < argc) {
+            seed = std::strtoull(argv[++i], nullptr, 10);
+        } else if (arg == "--examples" && i + 1 < argc) {
+            examplesDir = argv[++i];
+        } else if (arg == "--quick") {
+            generations = 200;
+            randomCases = 4;
+        } else {
+            std::cerr << "Option inconnue: " << arg << "\n";
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+
+    const std::vector<unsigned int> threadCounts = {2, 3, 4, 7};
+    const std::vector<int> bandSizes = {1, 3, 16};
+
+    std::cout << "============================================\n";
+    std::cout << "    Conformité des moteurs - Jeu de la Vie\n";
+    std::cout << "============================================\n\n";
+
+    std::vector<ConformanceCase> cases;
+
+    // Exemples fournis, en grille plane et torique
+    std::error_code ec;
+    if (std::filesystem::is_directory(examplesDir, ec)) {
+        for (const auto& file : BatchRunner::collectInputs(examplesDir)) {
+            auto grid = FileHandler::loadFromFile(file);
+            for (bool toroidal : {false, true}) {
+                cases.push_back({FileHandler::getBaseName(file), grid->getWidth(), grid->getHeight(),
+                                 toroidal, grid->toCodes()});
+            }
+        }
+    } else {
+        std::cout << "Dossier d'exemples introuvable: " << examplesDir << " (ignoré)\n";
+    }
+
+    // Grilles dégénérées : une ligne, une colonne, tores de largeur 1 et 2
+    cases.push_back(makeRandomCase(seed, 1000, 1, 1, true, 1.0, 0.0));
+    cases.push_back(makeRandomCase(seed, 1001, 17, 1, false, 0.6, 0.0));
+    cases.push_back(makeRandomCase(seed, 1002, 1, 13, true, 0.6, 0.0));
+    cases.push_back(makeRandomCase(seed, 1003, 2, 9, true, 0.5, 0.0));
+
+    // Soupes aléatoires de tailles, densités et topologies variées
+    for (int i = 0; i < randomCases; ++i) {
+        CounterRng rng(seed, 2000 + static_cast<std::uint64_t>(i));
+        int width = 3 + static_cast<int>(rng.next() % 46);
+        int height = 3 + static_cast<int>(rng.next() % 30);
+        double density = 0.2 + 0.4 * rng.nextDouble();
+        double obstacles = (i % 2 == 1) ? 0.05 + 0.1 * rng.nextDouble() : 0.0;
+        cases.push_back(makeRandomCase(seed, i, width, height, i % 4 >= 2, density, obstacles));
+        if (obstacles > 0.0) cases.back().name += " (obstacles)";
+    }
+
+    int failures = 0;
+    for (const auto& c : cases) {
+        if (!runCase(c, generations, threadCounts, bandSizes)) ++failures;
+    }
+
+    std::cout << "\n============================================\n";
+    std::cout << "Résultat: " << cases.size() - failures << "/" << cases.size() << " cas conformes\n";
+    std::cout << "============================================\n";
+
+    return failures == 0 ? 0 : 1;
+}
@@ -9,15 +9,45 @@
 #include <cassert>
 #include <memory>
 #include <sstream>
+#include <cstdio>
+#include <fstream>
+#include <algorithm>
+#include <chrono>
+#include <thread>
 #include "grid/Grid.hpp"
 #include "game/Game.hpp"
 #include "rules/ClassicRule.hpp"
 #include "cell/AliveState.hpp"
 #include "cell/DeadState.hpp"
 #include "cell/ObstacleAliveState.hpp"
+#include "cell/ObstacleDeadState.hpp"
 #include "io/FileHandler.hpp"
+#include "io/GenerationArchive.hpp"
+#include "grid/BandedGrid.hpp"
+#include "grid/QuadTree.hpp"
+#include "grid/DensityPyramid.hpp"
+#include "game/OutOfCoreGame.hpp"
+#include "game/BatchRunner.hpp"
+#include "game/SoupRunner.hpp"
+#include "game/AutoTuner.hpp"
+#include "game/SimulationThread.hpp"
+#include "bench/Scenario.hpp"
+#include "util/Metrics.hpp"
+#include "util/Tracer.hpp"
+#include "util/StatsServer.hpp"
+#include "util/CounterRng.hpp"
+#include "util/FrameHistory.hpp"
+#include "io/Checkpoint.hpp"
+#include <filesystem>
 #include "patterns/Patterns.hpp"
 
+#ifdef __linux__
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
 // Compteurs de tests
 int testsRun = 0;
 int testsPassed = 0;
@@ -288,6 +318,52 @@ void testObstacles() {
     ASSERT(game.getGrid().getCell(2, 2).isObstacle(), "Devrait toujours être un obstacle");
 }
 
+void testBandedGridMatchesGrid() {
+    // Largeurs autour des frontières de mots de 64 bits, bandes de tailles variées
+    const int sizes[][3] = {{70, 23, 4}, {64, 9, 1}, {130, 17, 7}, {5, 5, 64}};
+    unsigned int seed = 12345;
+    
+    for (bool toroidal : {false, true}) {
+        for (const auto& size : sizes) {
+            int width = size[0];
+            int height = size[1];
+            
+            std::vector<std::uint8_t> codes(static_cast<size_t>(width) * height);
+            for (auto& code : codes) {
+                seed = seed * 1103515245u + 12345u;
+                unsigned int r = (seed >> 16) % 100;
+                code = static_cast<std::uint8_t>(r < 35 ? 1 : (r < 38 ? 2 : (r < 40 ? 3 : 0)));
+            }
+            
+            Grid reference(width, height, codes, toroidal);
+            auto banded = std::make_unique<BandedGrid>("test_banded", width, height, toroidal, size[2]);
+            banded->importRows([&codes, width](int y, std::uint8_t* row) {
+                std::copy(codes.begin() + static_cast<size_t>(y) * width,
+                          codes.begin() + static_cast<size_t>(y + 1) * width, row);
+            });
+            OutOfCoreGame game(std::move(banded), std::make_unique<ClassicRule>(), 0);
+            ClassicRule rule;
+            
+            for (int i = 0; i < 12; ++i) {
+                reference.update(rule);
+                game.step();
+            }
+            
+            std::vector<std::uint8_t> expected = reference.toCodes();
+            long long alive = 0;
+            bool same = true;
+            game.getGrid().exportRows([&](int y, const std::uint8_t* row) {
+                for (int x = 0; x < width; ++x) {
+                    if (row[x] != expected[static_cast<size_t>(y) * width + x]) same = false;
+                    alive += row[x] & 1;
+                }
+            });
+            ASSERT(same, "La grille par bandes devrait évoluer comme Grid");
+            ASSERT(alive == game.countAliveCells(), "Population de la grille par bandes incorrecte");
+        }
+    }
+}
+
 // ============================================================================
 // Tests des patterns
 // ============================================================================
@@ -321,6 +397,635 @@ void testPlacePattern() {
     ASSERT(grid.getCell(4, 4).isAlive(), "Glider mal placé");
 }
 
+// ============================================================================
+// Tests des entrées/sorties
+// ============================================================================
+
+/**
+ * @brief Écrit un fichier texte pour les tests de chargement
+ */
+void writeTextFile(const std::string& path, const std::string& content) {
+    std::ofstream file(path);
+    file << content;
+}
+
+void testLoadFromFile() {
+    const std::string path = "test_load.txt";
+    
+    // Format libre : les lignes ne correspondent pas forcément aux rangées
+    writeTextFile(path, "2 3\n0 1 2\n3\n  1\t0\n");
+    auto grid = FileHandler::loadFromFile(path, true);
+    ASSERT(grid->getWidth() == 3 && grid->getHeight() == 2, "Dimensions incorrectes");
+    ASSERT(grid->isToroidal(), "Le mode torique devrait être appliqué");
+    ASSERT(grid->getCell(1, 0).isAlive(), "(1,0) devrait être vivante");
+    ASSERT(grid->getCell(2, 0).isObstacle() && !grid->getCell(2, 0).isAlive(), "(2,0) devrait être un obstacle mort");
+    ASSERT(grid->getCell(0, 1).isObstacle() && grid->getCell(0, 1).isAlive(), "(0,1) devrait être un obstacle vivant");
+    ASSERT(grid->getCell(1, 1).isAlive() && !grid->getCell(2, 1).isAlive(), "Dernière rangée incorrecte");
+    
+    // Entiers de plusieurs caractères acceptés comme avec une lecture par flux
+    writeTextFile(path, "2 2\n01 +1\n00 -0\n");
+    grid = FileHandler::loadFromFile(path);
+    ASSERT(grid->toCodes() == std::vector<std::uint8_t>({1, 1, 0, 0}), "\"01\", \"+1\", \"00\" et \"-0\" devraient être lus");
+    
+    // Les erreurs de validation sont conservées
+    auto expectError = [&path](const std::string& content, const std::string& message) {
+        writeTextFile(path, content);
+        try {
+            FileHandler::loadFromFile(path);
+        } catch (const std::runtime_error& e) {
+            ASSERT(std::string(e.what()) == message, "Message inattendu: " + std::string(e.what()));
+            return;
+        }
+        throw std::runtime_error("Une erreur était attendue: " + message);
+    };
+    expectError("", "Invalid file format: cannot read dimensions");
+    expectError("0 4\n", "Invalid dimensions: must be positive");
+    expectError("2 2\n0 1\n1\n", "Invalid file format: not enough cell data");
+    expectError("2 2\n0 x 1 1\n", "Invalid file format: not enough cell data");
+    expectError("2 2\n0 1\n7 1\n", "Invalid cell value: 7");
+    expectError("2 2\n0 1\n+07 1\n", "Invalid cell value: 7");
+    
+    // Sauvegarde à partir d'une copie des codes (sans Grid), relue à l'identique
+    FileHandler::saveCodes(3, 2, {0, 1, 0, 1, 1, 0}, path);
+    grid = FileHandler::loadFromFile(path);
+    ASSERT(grid->getWidth() == 3 && grid->getHeight() == 2 && grid->toCodes() == std::vector<std::uint8_t>({0, 1, 0, 1, 1, 0}),
+           "Les codes sauvegardés devraient être relus");
+    
+    std::remove(path.c_str());
+}
+
+void testGenerationArchive() {
+    const std::string path = "test_archive.gola";
+    
+    // Simulation de référence : glider torique avec un obstacle
+    Grid grid(12, 10, true);
+    grid.placePattern(Patterns::glider(), 1, 1);
+    grid.setCellState(8, 8, std::make_unique<ObstacleAliveState>());
+    
+    std::vector<Grid> expected;
+    {
+        ArchiveWriter writer(path, 12, 10, true, 4);
+        Game game(std::make_unique<Grid>(grid), std::make_unique<ClassicRule>(), 0);
+        for (int i = 0; i < 11; ++i) {
+            writer.append(game.getGrid());
+            expected.push_back(game.getGrid());
+            game.step();
+        }
+        writer.close();
+    }
+    
+    ArchiveReader reader(path);
+    ASSERT(reader.getGenerationCount() == 11, "L'archive devrait contenir 11 générations");
+    ASSERT(reader.isToroidal(), "L'archive devrait conserver le mode torique");
+    
+    // Accès direct dans le désordre (image clé + deltas)
+    for (int g : {7, 0, 10, 4, 5}) {
+        auto restored = reader.readGeneration(g);
+        ASSERT(restored->equals(expected[g]), "Génération reconstruite incorrecte");
+        ASSERT(restored->getCell(8, 8).isObstacle(), "L'obstacle devrait être conservé");
+    }
+    
+    std::remove(path.c_str());
+}
+
+void testMacrocell() {
+    const std::string path = "test_pattern.mc";
+    
+    // Aller-retour d'une grille avec obstacles (format multi-états)
+    Grid grid(40, 30);
+    grid.placePattern(Patterns::glider(), 3, 2);
+    grid.placePattern(Patterns::blinker(), 30, 20);
+    grid.setCellState(39, 29, std::make_unique<ObstacleAliveState>());
+    grid.setCellState(17, 0, std::make_unique<ObstacleDeadState>());
+    FileHandler::saveToFile(grid, path);
+    auto loaded = FileHandler::loadFromFile(path);
+    ASSERT(loaded->equals(grid), "La grille relue devrait être identique");
+    ASSERT(loaded->getCell(17, 0).isObstacle(), "L'obstacle mort devrait être conservé");
+    
+    // Fichier externe sans dimensions : la grille est réduite au motif
+    writeTextFile(path, "[M2] (golly 2.0)\n#R B3/S23\n$$..*$...*$.***$\n4 1 0 0 0\n");
+    loaded = FileHandler::loadFromFile(path);
+    ASSERT(loaded->getWidth() == 3 && loaded->getHeight() == 3, "La grille devrait englober le glider");
+    ASSERT(loaded->toCodes() == std::vector<std::uint8_t>({0, 1, 0, 0, 0, 1, 1, 1, 1}), "Le glider devrait être relu");
+    
+    // Motif immense mais régulier : blocs tous les 8 cellules, sans grille dense
+    const int size = 1 << 12;
+    QuadTreeBuilder builder(size, size);
+    std::vector<std::uint8_t> row(size, 0);
+    for (int y = 0; y < size; ++y) {
+        for (int x = 0; x < size; ++x) {
+            row[x] = (y % 8 < 2 && x % 8 < 2) ? 1 : 0;
+        }
+        builder.addRow(row.data());
+    }
+    auto tree = builder.finish();
+    ASSERT(tree->countAliveCells() == 4LL * (size / 8) * (size / 8), "Population incorrecte");
+    ASSERT(tree->getNodeCount() == 10, "Les sous-arbres identiques devraient être partagés");
+    
+    FileHandler::saveMacrocell(*tree, path);
+    auto reloaded = FileHandler::loadMacrocell(path);
+    ASSERT(reloaded->getNodeCount() == 10 && reloaded->getWidth() == size, "L'arbre relu devrait être identique");
+    std::vector<std::uint8_t> reloadedRow(size);
+    reloaded->fillRow(size - 7, reloadedRow.data());
+    ASSERT(reloadedRow[size - 8] == 1 && reloadedRow[size - 7] == 1 && reloadedRow[size - 6] == 0,
+           "Ligne relue incorrecte");
+    
+    // Fichier invalide : enfant faisant référence à une ligne inexistante
+    writeTextFile(path, "[M2]\n4 1 0 0 0\n");
+    bool thrown = false;
+    try {
+        FileHandler::loadMacrocell(path);
+    } catch (const std::runtime_error& e) {
+        thrown = std::string(e.what()) == "Invalid macrocell format: line 2";
+    }
+    ASSERT(thrown, "Une référence invalide devrait être signalée");
+    
+    std::remove(path.c_str());
+}
+
+void testBatchRunner() {
+    const std::string dir = "test_batch";
+    std::filesystem::create_directories(dir + "/a");
+    writeTextFile(dir + "/a/blinker.txt", "5 5\n0 0 0 0 0\n0 0 1 0 0\n0 0 1 0 0\n0 0 1 0 0\n0 0 0 0 0\n");
+    writeTextFile(dir + "/block.txt", "4 4\n0 0 0 0\n0 1 1 0\n0 1 1 0\n0 0 0 0\n");
+    writeTextFile(dir + "/manifest.txt", "# lot de test\na/blinker.txt\n\nblock.txt\nabsent.txt\n");
+    
+    auto inputs = BatchRunner::collectInputs(dir + "/manifest.txt");
+    ASSERT(inputs.size() == 3, "Le manifeste devrait lister 3 fichiers");
+    
+    BatchOptions options;
+    options.iterations = 50;
+    options.outputRoot = dir;
+    options.threadCount = 2;
+    auto results = BatchRunner(options).run(inputs);
+    
+    ASSERT(results[0].success && results[0].period == 2, "Le blinker devrait avoir une période de 2");
+    ASSERT(results[0].finalGeneration == 2, "Le cycle devrait arrêter la simulation");
+    ASSERT(results[1].success && results[1].period == 1 && results[1].population == 4, "Le bloc devrait être stable");
+    ASSERT(!results[2].success && !results[2].error.empty(), "Un fichier absent devrait être signalé");
+    ASSERT(std::filesystem::exists(dir + "/blinker_out/iteration_1.txt"), "Les itérations devraient être écrites");
+    
+    std::ostringstream summary;
+    BatchRunner::writeSummary(results, summary);
+    ASSERT(summary.str().find(",oscillating,2,") != std::string::npos, "Le récapitulatif devrait indiquer la période");
+    
+    std::filesystem::remove_all(dir);
+}
+
+void testScenarioSuite() {
+    const std::string dir = "test_scenarios";
+    std::filesystem::create_directories(dir);
+    writeTextFile(dir + "/blinker.txt", "5 5\n0 0 0 0 0\n0 0 1 0 0\n0 0 1 0 0\n0 0 1 0 0\n0 0 0 0 0\n");
+    writeTextFile(dir + "/scenarios.cfg",
+                  "# scénarios de test\n"
+                  "blinker file file=blinker.txt generations=5 warmup=0 reps=1\n"
+                  "soup soup size=16x16 density=0.4 obstacles=0.1 seed=3 generations=10 reps=2 threshold=1000\n");
+    writeTextFile(dir + "/invalid.txt", "soup soup size=16\n");
+    
+    auto scenarios = ScenarioSuite::loadFile(dir + "/scenarios.cfg");
+    ASSERT(scenarios.size() == 2 && scenarios[0].file == dir + "/blinker.txt", "Le chemin devrait être relatif au fichier");
+    bool thrown = false;
+    try { ScenarioSuite::loadFile(dir + "/invalid.txt"); } catch (const std::runtime_error&) { thrown = true; }
+    ASSERT(thrown, "Un scénario invalide devrait être rejeté");
+    
+    std::vector<ScenarioResult> results = {ScenarioSuite::run(scenarios[0]), ScenarioSuite::run(scenarios[1])};
+    ASSERT(results[0].generations == 5 && results[0].population == 3, "Le blinker devrait garder 3 cellules");
+    ASSERT(ScenarioSuite::run(scenarios[1]).hash == results[1].hash, "Une soupe devrait être reproductible");
+    
+    // Une référence identique passe, une population différente est signalée
+    {
+        std::ofstream csv(dir + "/baseline.csv");
+        ScenarioSuite::writeCsv(csv, results);
+    }
+    auto baseline = ScenarioSuite::loadBaseline(dir + "/baseline.csv");
+    auto comparisons = ScenarioSuite::compare(results, scenarios, baseline, 1000.0);
+    ASSERT(comparisons[1].status == ScenarioComparison::Status::Ok, "Une référence identique devrait passer");
+    baseline["soup"].population += 1;
+    baseline.erase("blinker");
+    comparisons = ScenarioSuite::compare(results, scenarios, baseline, 1000.0);
+    ASSERT(comparisons[0].status == ScenarioComparison::Status::New, "Un scénario absent de la référence est nouveau");
+    ASSERT(comparisons[1].status == ScenarioComparison::Status::Mismatch, "Un résultat différent devrait être signalé");
+    
+    std::filesystem::remove_all(dir);
+}
+
+void testMetrics() {
+    Histogram histogram;
+    for (std::uint64_t value : {100u, 200u, 300u, 5000u}) histogram.record(value);
+    ASSERT(histogram.getCount() == 4 && histogram.getSum() == 5600, "L'histogramme devrait compter les mesures");
+    ASSERT(histogram.getMin() == 100 && histogram.getMax() == 5000, "L'histogramme devrait garder les extrêmes");
+    ASSERT(histogram.percentile(0.5) >= 128 && histogram.percentile(0.5) < 512, "La médiane devrait être dans le bon seau");
+    ASSERT(histogram.percentile(1.0) == 5000, "Le quantile 1 devrait être le maximum");
+    
+    // Désactivées, les phases ne sont pas mesurées
+    Metrics& metrics = Metrics::instance();
+    metrics.reset();
+    auto grid = std::make_unique<Grid>(8, 8);
+    grid->placePattern(Patterns::blinker(), 2, 2);
+    Game game(std::move(grid), std::make_unique<ClassicRule>(), 3);
+    game.step();
+    ASSERT(metrics.getHistogram(Metrics::Phase::Step).getCount() == 0, "Aucune mesure sans activation");
+    
+    Metrics::setEnabled(true);
+    game.step();
+    game.step();
+    Metrics::setEnabled(false);
+    ASSERT(metrics.getHistogram(Metrics::Phase::Step).getCount() == 2, "Chaque itération devrait être mesurée");
+    ASSERT(metrics.getHistogram(Metrics::Phase::NeighborCount).getCount() == 2, "Le comptage des voisins devrait être mesuré");
+    
+    std::ostringstream json;
+    metrics.writeJson(json);
+    ASSERT(json.str().find("\"grid.rule\": {\"count\": 2") != std::string::npos, "Le JSON devrait contenir les phases");
+    ASSERT(json.str().find("io.save") == std::string::npos, "Les phases vides devraient être omises");
+    metrics.reset();
+}
+
+void testTracer() {
+    Tracer& tracer = Tracer::instance();
+    auto grid = std::make_unique<Grid>(16, 16);
+    grid->placePattern(Patterns::blinker(), 4, 4);
+    Game game(std::move(grid), std::make_unique<ClassicRule>(), 3);
+    game.setParallel(true);
+    game.setThreadCount(2);
+    
+    // Arrêté, aucune portée n'est enregistrée
+    tracer.start();
+    tracer.stop();
+    game.step();
+    ASSERT(tracer.getEventCount() == 0, "Aucun événement hors enregistrement");
+    
+    tracer.start();
+    game.step();
+    tracer.stop();
+    ASSERT(tracer.getEventCount() >= 4, "L'itération, les bandes et l'application devraient être tracées");
+    
+    std::ostringstream json;
+    tracer.writeJson(json);
+    ASSERT(json.str().find("\"name\": \"Game::step\"") != std::string::npos, "La trace devrait contenir Game::step");
+    ASSERT(json.str().find("\"worker 1\"") != std::string::npos, "Les threads de calcul devraient être nommés");
+    ASSERT(json.str().find("\"ph\": \"X\"") != std::string::npos, "Les portées devraient être des événements complets");
+    
+    // Au-delà de la capacité, les événements sont comptés puis ignorés
+    tracer.start(1);
+    game.step();
+    tracer.stop();
+    ASSERT(tracer.getEventCount() == 1 && tracer.getDroppedCount() > 0, "Les événements en excès devraient être ignorés");
+}
+
+void testStatsServer() {
+    StatsServer server;
+    server.publish(42, 1234, 3, 256 * 256);
+    server.setCheckpointQueueDepth(1);
+    server.setOutputWriteSeconds(0.5);
+    server.publishGeneration(43, 256 * 256);
+    std::string body = server.render();
+    ASSERT(body.find("# TYPE gameoflife_generation gauge\ngameoflife_generation 43\n") != std::string::npos,
+           "La génération devrait être exposée");
+    ASSERT(body.find("gameoflife_population 1234\n") != std::string::npos, "La population devrait être exposée");
+    ASSERT(body.find("gameoflife_active_tiles 3\n") != std::string::npos, "Les tuiles actives devraient être exposées");
+    ASSERT(body.find("gameoflife_population_generation 42\n") != std::string::npos,
+           "La génération de la population devrait être exposée séparément");
+    ASSERT(body.find("gameoflife_checkpoint_queue_depth 1\n") != std::string::npos, "La file des points de contrôle devrait être exposée");
+    ASSERT(body.find("gameoflife_output_write_seconds 0.5\n") != std::string::npos, "La durée d'écriture devrait être exposée");
+    ASSERT(!server.takePopulationRequest(), "Sans lecture, la population n'est pas à recalculer");
+    
+#ifdef __linux__
+    ASSERT(body.find("process_resident_memory_bytes") != std::string::npos, "La mémoire résidente devrait être exposée");
+    
+    // Requête HTTP réelle sur un port choisi par le système
+    server.start(0);
+    ASSERT(server.isRunning() && server.getPort() > 0, "Le serveur devrait écouter sur un port libre");
+    int client = socket(AF_INET, SOCK_STREAM, 0);
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    address.sin_port = htons(static_cast<uint16_t>(server.getPort()));
+    ASSERT(connect(client, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == 0, "La connexion devrait réussir");
+    std::string request = "GET /metrics HTTP/1.1\r\nHost: localhost\r\n\r\n";
+    send(client, request.data(), request.size(), 0);
+    std::string response;
+    char buffer[4096];
+    ssize_t received;
+    while ((received = recv(client, buffer, sizeof(buffer), 0)) > 0) response.append(buffer, static_cast<size_t>(received));
+    close(client);
+    server.stop();
+    ASSERT(response.compare(0, 15, "HTTP/1.1 200 OK") == 0, "La réponse devrait être 200 OK");
+    ASSERT(response.find("gameoflife_generation 43") != std::string::npos, "La réponse devrait contenir les métriques");
+    ASSERT(server.takePopulationRequest() && !server.takePopulationRequest(),
+           "Une lecture devrait demander un seul recalcul de la population");
+    ASSERT(!server.isRunning(), "Le serveur devrait être arrêté");
+#endif
+}
+
+void testAutoTuner() {
+    TuningConfig parallel;
+    parallel.parallel = true;
+    parallel.threads = 3;
+    parallel.bandRows = 8;
+    parallel.cellsPerSecond = 2e6;
+    TuningConfig sequential;
+    sequential.cellsPerSecond = 1e6;
+    
+    TuningProfile profile;
+    profile.set(1024, 1024, 0.3, false, parallel);
+    profile.set(32, 32, 0.3, false, sequential);
+    const TuningConfig* config = profile.find(900, 900, 0.5, false);
+    ASSERT(config != nullptr && config->parallel && config->threads == 3, "La classe de taille la plus proche devrait être choisie");
+    config = profile.find(40, 40, 0.3, false);
+    ASSERT(config != nullptr && !config->parallel, "Les petites grilles devraient rester séquentielles");
+    ASSERT(profile.find(1024, 1024, 0.3, true) == nullptr, "La topologie devrait être respectée");
+    config = profile.find(256, 256, 0.3, false);
+    ASSERT(config != nullptr && config->parallel, "Une taille encadrée devrait prendre l'entrée la plus proche");
+    ASSERT(profile.find(8, 8, 0.3, false) == nullptr && profile.find(8192, 8192, 0.3, false) == nullptr,
+           "Une taille hors de la plage mesurée ne devrait rien appliquer");
+    
+    // Un seul réglage (256x256 par défaut) ne s'étend pas aux petites grilles
+    TuningProfile single;
+    single.set(256, 256, 0.3, false, parallel);
+    ASSERT(single.find(200, 300, 0.3, false) != nullptr, "Une classe de taille voisine devrait convenir");
+    ASSERT(single.find(40, 40, 0.3, false) == nullptr, "Une petite grille ne devrait pas hériter du parallèle");
+    
+    std::string path = "test_tuning.cfg";
+    profile.save(path);
+    TuningProfile loaded = TuningProfile::load(path);
+    std::remove(path.c_str());
+    ASSERT(loaded.getEntries().size() == 2, "Le profil devrait être relu");
+    config = loaded.find(1024, 1024, 0.3, false);
+    ASSERT(config != nullptr && config->bandRows == 8 && config->cellsPerSecond == 2e6, "La stratégie devrait être relue");
+    ASSERT(TuningProfile::load("missing_tuning.cfg").empty(), "Un profil absent devrait être vide");
+    
+    // Game applique la stratégie correspondant à sa grille
+    auto grid = std::make_unique<Grid>(1024, 1024);
+    Game game(std::move(grid), std::make_unique<ClassicRule>(), 1);
+    ASSERT(game.applyTuning(loaded) && game.isParallel() && game.getBandRows() == 8, "Le profil devrait être appliqué");
+    
+    // Le parallèle doit battre nettement le séquentiel
+    sequential.cellsPerSecond = 1.97e6;
+    ASSERT(!AutoTuner::best({sequential, parallel}).parallel, "Un gain inférieur à 5 % ne justifie pas les threads");
+    
+    AutoTuner tuner(48, 48, 0.4, true);
+    auto measured = tuner.run(0.0, nullptr, 4);
+    ASSERT(measured.size() >= 3 && !measured.front().parallel, "Le séquentiel et plusieurs stratégies parallèles devraient être mesurés");
+    for (const auto& candidate : measured) {
+        ASSERT(candidate.cellsPerSecond > 0.0, "Chaque candidat devrait avoir un débit");
+    }
+}
+
+void testSimulationThread() {
+    // Triple tampon : le consommateur ne voit que la dernière valeur publiée
+    TripleBuffer<int> buffer;
+    ASSERT(!buffer.fetch(), "Rien ne devrait être publié au départ");
+    buffer.back() = 1;
+    ASSERT(buffer.publish(), "La première publication ne remplace rien");
+    buffer.back() = 2;
+    ASSERT(!buffer.publish(), "Une publication non récupérée devrait être remplacée");
+    ASSERT(buffer.fetch() && buffer.front() == 2, "La valeur la plus récente devrait être récupérée");
+    ASSERT(!buffer.fetch() && buffer.front() == 2, "Une valeur ne devrait être récupérée qu'une fois");
+    
+    // Clignotant exécuté sur le thread de simulation
+    auto grid = std::make_unique<Grid>(5, 5);
+    for (int x = 1; x <= 3; ++x) {
+        grid->setCellState(x, 2, std::make_unique<AliveState>());
+    }
+    Game game(std::move(grid), std::make_unique<ClassicRule>());
+    SimulationThread simulation(game, 0);
+    ASSERT(simulation.getFrame().population == 3 && simulation.getFrame().width == 5,
+           "La première génération devrait être disponible immédiatement");
+    
+    ASSERT(simulation.isIdle(), "Sans commande ni génération en attente, la simulation est au repos");
+    simulation.submit([](Game& g) { g.step(); });
+    simulation.flush();
+    ASSERT(!simulation.isIdle(), "Une génération publiée non récupérée devrait être signalée");
+    ASSERT(simulation.fetchFrame(), "Une commande devrait publier une génération");
+    ASSERT(simulation.isIdle(), "La génération récupérée, la simulation retourne au repos");
+    const SimulationFrame& frame = simulation.getFrame();
+    ASSERT(frame.iteration == 1 && frame.codes[1 * 5 + 2] == 1 && frame.codes[2 * 5 + 1] == 0,
+           "Le clignotant devrait être vertical après une génération");
+    
+    // En marche, les générations avancent sans intervention de l'appelant
+    simulation.submit([](Game& g) { g.start(); });
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (simulation.getFrame().iteration < 20 && std::chrono::steady_clock::now() < deadline) {
+        simulation.fetchFrame();
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    simulation.submit([](Game& g) { g.pause(); });
+    simulation.flush();
+    simulation.fetchFrame();
+    ASSERT(simulation.getFrame().iteration >= 20 && !simulation.getFrame().running,
+           "La simulation devrait avancer seule puis s'arrêter");
+    ASSERT(simulation.getFrame().population == 3, "Le clignotant devrait garder 3 cellules");
+    
+    simulation.submit([](Game&) { throw std::runtime_error("test"); });
+    simulation.flush();
+    ASSERT(simulation.takeError() == "test" && simulation.takeError().empty(), "L'erreur d'une commande devrait être remontée une fois");
+}
+
+void testTurboMode() {
+    auto grid = std::make_unique<Grid>(16, 16);
+    for (int x = 1; x <= 3; ++x) {
+        grid->setCellState(x, 2, std::make_unique<AliveState>());
+    }
+    Game game(std::move(grid), std::make_unique<ClassicRule>());
+    
+    // Intervalle normal d'une seconde : seul le turbo peut avancer vite
+    SimulationThread simulation(game, 1000);
+    simulation.setTurbo(true);
+    simulation.setPublishInterval(20);
+    simulation.submit([](Game& g) { g.start(); });
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (simulation.getFrame().iteration < 200 && std::chrono::steady_clock::now() < deadline) {
+        simulation.fetchFrame();
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    const SimulationFrame& frame = simulation.getFrame();
+    ASSERT(frame.iteration >= 200 && frame.turbo, "Le turbo devrait enchaîner les générations");
+    ASSERT(frame.sequence < static_cast<std::uint64_t>(frame.iteration) / 2,
+           "Le turbo ne devrait publier qu'une partie des générations");
+    
+    // L'arrêt publie la dernière génération calculée
+    simulation.submit([](Game& g) { g.pause(); });
+    simulation.flush();
+    simulation.fetchFrame();
+    ASSERT(simulation.getFrame().iteration == game.getIteration() && simulation.getFrame().population == 3,
+           "La génération affichée devrait être la dernière calculée");
+}
+
+void testDirtyTiles() {
+    const int tile = SimulationFrame::TILE_SIZE;
+    auto grid = std::make_unique<Grid>(tile * 3, tile * 2);
+    Game game(std::move(grid), std::make_unique<ClassicRule>());
+    SimulationThread simulation(game, 0);
+    const SimulationFrame& first = simulation.getFrame();
+    ASSERT(first.tilesX == 3 && first.tilesY == 2 && first.sequence == 1, "La première frame devrait couvrir toutes les tuiles");
+    
+    // Une cellule modifiée ne salit que sa tuile
+    simulation.submit([tile](Game& g) { g.getGrid().setCellState(tile + 1, 1, std::make_unique<AliveState>()); });
+    simulation.flush();
+    simulation.fetchFrame();
+    const SimulationFrame& frame = simulation.getFrame();
+    ASSERT(frame.baseSequence == 1 && frame.sequence == 2, "Les changements devraient partir de la frame précédente");
+    ASSERT(frame.dirtyTiles == std::vector<std::uint8_t>({0, 1, 0, 0, 0, 0}), "Seule la tuile modifiée devrait être sale");
+    
+    // Une frame non récupérée transmet ses tuiles à la suivante
+    simulation.submit([](Game& g) { g.getGrid().setCellState(0, 0, std::make_unique<AliveState>()); });
+    simulation.flush();
+    simulation.submit([tile](Game& g) { g.getGrid().setCellState(tile * 3 - 1, tile * 2 - 1, std::make_unique<AliveState>()); });
+    simulation.flush();
+    simulation.fetchFrame();
+    ASSERT(simulation.getFrame().baseSequence == 2 && simulation.getFrame().sequence == 4,
+           "La référence devrait rester la dernière frame récupérée");
+    ASSERT(simulation.getFrame().dirtyTiles == std::vector<std::uint8_t>({1, 0, 0, 0, 0, 1}),
+           "Les tuiles de la frame abandonnée devraient être conservées");
+}
+
+void testDensityPyramid() {
+    const int width = 37;
+    const int height = 29;
+    std::vector<std::uint8_t> codes(static_cast<size_t>(width) * height);
+    CounterRng rng(7, 0);
+    for (auto& code : codes) {
+        code = static_cast<std::uint8_t>(rng.next() % 4);
+    }
+    
+    DensityPyramid pyramid;
+    pyramid.rebuild(codes.data(), width, height);
+    ASSERT(pyramid.getLevelCount() == 6 && pyramid.getLevelWidth(1) == 19 && pyramid.getLevelHeight(6) == 1,
+           "Les niveaux devraient aller jusqu'à un seul bloc");
+    
+    // Niveau 1 : proportion de cellules vivantes de chaque bloc 2x2 (hors grille = mortes)
+    bool exact = true;
+    for (int by = 0; by < pyramid.getLevelHeight(1); ++by) {
+        for (int bx = 0; bx < pyramid.getLevelWidth(1); ++bx) {
+            int alive = 0;
+            for (int y = by * 2; y < std::min(by * 2 + 2, height); ++y) {
+                for (int x = bx * 2; x < std::min(bx * 2 + 2, width); ++x) {
+                    alive += codes[static_cast<size_t>(y) * width + x] & 1;
+                }
+            }
+            exact = exact && pyramid.getDensity(1, bx, by) == (alive * 255 + 2) / 4;
+        }
+    }
+    ASSERT(exact, "Le niveau 1 devrait compter les cellules vivantes de chaque bloc");
+    
+    // Une mise à jour locale donne la même pyramide qu'une reconstruction complète
+    for (int y = 5; y < 17; ++y) {
+        for (int x = 30; x < width; ++x) {
+            codes[static_cast<size_t>(y) * width + x] = 1;
+        }
+    }
+    pyramid.update(codes.data(), 30, 5, width - 30, 12);
+    DensityPyramid rebuilt;
+    rebuilt.rebuild(codes.data(), width, height);
+    bool same = true;
+    for (int level = 1; level <= pyramid.getLevelCount(); ++level) {
+        size_t size = static_cast<size_t>(pyramid.getLevelWidth(level)) * pyramid.getLevelHeight(level);
+        same = same && std::equal(pyramid.getLevel(level), pyramid.getLevel(level) + size, rebuilt.getLevel(level));
+    }
+    ASSERT(same, "La mise à jour incrémentale devrait égaler une reconstruction");
+}
+
+void testSoupRunner() {
+    // Vecteur de référence Philox 4x32-10 (compteur et clé nuls)
+    CounterRng rng(0, 0);
+    ASSERT(rng.next() == 0x6627e8d5u && rng.next() == 0xe169c58du, "Philox devrait suivre la référence");
+    
+    SoupOptions options;
+    options.width = 12;
+    options.height = 12;
+    options.density = 0.4;
+    options.seed = 42;
+    options.count = 24;
+    options.maxGenerations = 500;
+    
+    // Les résultats ne dépendent pas du nombre de threads
+    std::vector<std::vector<int>> results[2];
+    SoupStatistics stats[2];
+    for (int run = 0; run < 2; ++run) {
+        options.threadCount = (run == 0) ? 1 : 3;
+        results[run].assign(options.count, {});
+        stats[run] = SoupRunner(options).run([&results, run](const SoupResult& result) {
+            results[run][result.index] = {result.lifespan, result.finalPopulation, result.period};
+        });
+    }
+    ASSERT(results[0] == results[1], "Chaque soupe devrait être reproductible");
+    ASSERT(stats[0].soups == 24 && stats[0].lifespanSum == stats[1].lifespanSum, "Statistiques incohérentes");
+    ASSERT(stats[0].maxLifespanSoup == stats[1].maxLifespanSoup, "La soupe la plus longue devrait être la même");
+    
+    // Une soupe rejouée seule est identique
+    std::vector<std::uint8_t> codes;
+    SoupRunner runner(options);
+    runner.generateSoup(stats[0].maxLifespanSoup, codes);
+    Game game(std::make_unique<Grid>(12, 12, codes), std::make_unique<ClassicRule>(), 500);
+    game.setCycleDetection(options.maxPeriod);
+    while (game.step()) {}
+    ASSERT(game.getIteration() - game.getPeriod() == stats[0].maxLifespan, "La soupe rejouée devrait avoir la même durée de vie");
+}
+
+void testCheckpointResume() {
+    const std::string dir = "test_ckpt";
+    std::filesystem::create_directories(dir);
+    
+    Grid grid(20, 15, true);
+    grid.placePattern(Patterns::glider(), 2, 2);
+    grid.placePattern(Patterns::blinker(), 12, 8);
+    grid.setCellState(0, 14, std::make_unique<ObstacleAliveState>());
+    
+    // Simulation de référence sans interruption
+    Game reference(std::make_unique<Grid>(grid), std::make_unique<ClassicRule>(), 0);
+    for (int i = 0; i < 30; ++i) reference.step();
+    
+    // Simulation interrompue à l'itération 17, puis reprise
+    Game interrupted(std::make_unique<Grid>(grid), std::make_unique<ClassicRule>(), 0);
+    for (int i = 0; i < 17; ++i) interrupted.step();
+    Checkpoint::write(Checkpoint::capture(interrupted), Checkpoint::getCheckpointFilename(dir, 17));
+    
+    // Un point de contrôle plus récent mais corrompu doit être ignoré
+    writeTextFile(Checkpoint::getCheckpointFilename(dir, 20), "GOLCKPT1 tronqué");
+    
+    CheckpointData data;
+    std::string loaded = Checkpoint::loadLatest(dir, data);
+    ASSERT(loaded == Checkpoint::getCheckpointFilename(dir, 17), "Le dernier point de contrôle valide devrait être chargé");
+    
+    Game resumed(std::make_unique<Grid>(5, 5), std::make_unique<ClassicRule>(), 0);
+    Checkpoint::restore(data, resumed);
+    ASSERT(resumed.getIteration() == 17, "L'itération devrait être restaurée");
+    ASSERT(resumed.getGrid().isToroidal(), "Le mode torique devrait être restauré");
+    for (int i = 0; i < 13; ++i) resumed.step();
+    
+    ASSERT(resumed.getGrid().equals(reference.getGrid()), "La reprise devrait donner le même résultat");
+    ASSERT(resumed.getGrid().getCell(0, 14).isObstacle(), "L'obstacle devrait être restauré");
+    
+    std::filesystem::remove_all(dir);
+}
+
+void testPerfOverlayCounters() {
+    // Fenêtre glissante : seules les dernières mesures comptent, dans l'ordre d'arrivée
+    FrameHistory history(4);
+    ASSERT(history.getCount() == 0 && history.getMax() == 0.0f, "Une fenêtre vide devrait tout donner à 0");
+    for (float value : {10.0f, 2.0f, 6.0f, 4.0f, 8.0f}) {
+        history.push(value);
+    }
+    ASSERT(history.getCount() == 4 && history.getSample(0) == 2.0f && history.getSample(3) == 8.0f,
+           "La plus ancienne mesure devrait être remplacée");
+    ASSERT(history.getMin() == 2.0f && history.getMax() == 8.0f && history.getAverage() == 5.0f,
+           "Min, moyenne et max devraient porter sur la fenêtre");
+    
+    // Compteurs du jeu publiés avec chaque génération
+    Game game(std::make_unique<Grid>(64, 64), std::make_unique<ClassicRule>());
+    ASSERT(game.getLastStepNanoseconds() == 0, "Aucune durée avant la première itération");
+    ASSERT(game.memoryBytes() >= 2 * game.getGrid().memoryBytes() &&
+           game.getGrid().memoryBytes() >= size_t(64) * 64 * sizeof(Cell),
+           "La mémoire devrait couvrir les cellules de la grille et de la grille précédente");
+    game.getGrid().setCellState(1, 1, std::make_unique<AliveState>());
+    game.step();
+    ASSERT(game.getLastStepNanoseconds() > 0, "La durée de l'itération devrait être mesurée");
+    
+    SimulationThread simulation(game, 0);
+    ASSERT(simulation.getFrame().stepMilliseconds > 0.0 && simulation.getFrame().memoryBytes == game.memoryBytes(),
+           "La génération publiée devrait porter les compteurs du jeu");
+}
+
 // ============================================================================
 // Test de vérification de grille attendue
 // ============================================================================
@@ -399,12 +1104,32 @@ int main() {
     RUN_TEST(testBlockStable);
     RUN_TEST(testGliderMovement);
     RUN_TEST(testObstacles);
+    RUN_TEST(testBandedGridMatchesGrid);
     
     // Tests des patterns
     std::cout << "\n--- Tests des patterns ---\n";
     RUN_TEST(testPatterns);
     RUN_TEST(testPlacePattern);
     
+    // Tests des entrées/sorties
+    std::cout << "\n--- Tests des entrées/sorties ---\n";
+    RUN_TEST(testLoadFromFile);
+    RUN_TEST(testGenerationArchive);
+    RUN_TEST(testMacrocell);
+    RUN_TEST(testCheckpointResume);
+    RUN_TEST(testBatchRunner);
+    RUN_TEST(testSoupRunner);
+    RUN_TEST(testScenarioSuite);
+    RUN_TEST(testMetrics);
+    RUN_TEST(testTracer);
+    RUN_TEST(testStatsServer);
+    RUN_TEST(testAutoTuner);
+    RUN_TEST(testSimulationThread);
+    RUN_TEST(testTurboMode);
+    RUN_TEST(testDirtyTiles);
+    RUN_TEST(testDensityPyramid);
+    RUN_TEST(testPerfOverlayCounters);
+    
     // Test de la fonction de vérification
     std::cout << "\n--- Tests de vérification de grille ---\n";
     RUN_TEST(testVerifyGridFunction);
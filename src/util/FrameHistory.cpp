@@ -0,0 +1,53 @@
+#include "util/FrameHistory.hpp"
+#include <algorithm>
+
+FrameHistory::FrameHistory(size_t capacity)
+    : m_samples(std::max<size_t>(capacity, 1), 0.0f)
+    , m_next(0)
+    , m_count(0)
+{
+}
+
+void FrameHistory::push(float value) {
+    m_samples[m_next] = value;
+    m_next = (m_next + 1) % m_samples.size();
+    m_count = std::min(m_count + 1, m_samples.size());
+}
+
+void FrameHistory::clear() {
+    m_next = 0;
+    m_count = 0;
+}
+
+float FrameHistory::getSample(size_t index) const {
+    // La plus ancienne mesure précède l'emplacement de la prochaine de m_count positions
+    size_t start = (m_next + m_samples.size() - m_count) % m_samples.size();
+    return m_samples[(start + index) % m_samples.size()];
+}
+
+float FrameHistory::getMin() const {
+    if (m_count == 0) return 0.0f;
+    float result = getSample(0);
+    for (size_t i = 1; i < m_count; ++i) {
+        result = std::min(result, getSample(i));
+    }
+    return result;
+}
+
+float FrameHistory::getAverage() const {
+    if (m_count == 0) return 0.0f;
+    double sum = 0.0;
+    for (size_t i = 0; i < m_count; ++i) {
+        sum += getSample(i);
+    }
+    return static_cast<float>(sum / m_count);
+}
+
+float FrameHistory::getMax() const {
+    if (m_count == 0) return 0.0f;
+    float result = getSample(0);
+    for (size_t i = 1; i < m_count; ++i) {
+        result = std::max(result, getSample(i));
+    }
+    return result;
+}
@@ -0,0 +1,139 @@
+#include "util/Metrics.hpp"
+#include <algorithm>
+
+std::atomic<bool> Metrics::s_enabled{false};
+
+namespace {
+
+/**
+ * @brief Seau d'une durée : nombre de bits significatifs
+ */
+int bucketIndex(std::uint64_t value) {
+    int index = 0;
+    while (value != 0) {
+        ++index;
+        value >>= 1;
+    }
+    return index < Histogram::BUCKET_COUNT ? index : Histogram::BUCKET_COUNT - 1;
+}
+
+/**
+ * @brief Borne supérieure (exclue) d'un seau
+ */
+std::uint64_t bucketUpperBound(int index) {
+    return index >= Histogram::BUCKET_COUNT - 1 ? UINT64_MAX : (std::uint64_t(1) << index);
+}
+
+} // namespace
+
+void Histogram::record(std::uint64_t nanoseconds) {
+    m_count.fetch_add(1, std::memory_order_relaxed);
+    m_sum.fetch_add(nanoseconds, std::memory_order_relaxed);
+    m_buckets[bucketIndex(nanoseconds)].fetch_add(1, std::memory_order_relaxed);
+
+    std::uint64_t current = m_min.load(std::memory_order_relaxed);
+    while (nanoseconds < current &&
+           !m_min.compare_exchange_weak(current, nanoseconds, std::memory_order_relaxed)) {
+    }
+    current = m_max.load(std::memory_order_relaxed);
+    while (nanoseconds > current &&
+           !m_max.compare_exchange_weak(current, nanoseconds, std::memory_order_relaxed)) {
+    }
+}
+
+void Histogram::reset() {
+    m_count.store(0, std::memory_order_relaxed);
+    m_sum.store(0, std::memory_order_relaxed);
+    m_min.store(UINT64_MAX, std::memory_order_relaxed);
+    m_max.store(0, std::memory_order_relaxed);
+    for (auto& bucket : m_buckets) {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+}
+
+std::uint64_t Histogram::getMin() const {
+    return getCount() == 0 ? 0 : m_min.load(std::memory_order_relaxed);
+}
+
+std::uint64_t Histogram::percentile(double quantile) const {
+    std::uint64_t count = getCount();
+    if (count == 0) return 0;
+
+    std::uint64_t rank = static_cast<std::uint64_t>(quantile * count);
+    if (rank >= count) rank = count - 1;
+    std::uint64_t seen = 0;
+    for (int i = 0; i < BUCKET_COUNT; ++i) {
+        std::uint64_t bucket = getBucket(i);
+        if (seen + bucket > rank) {
+            if (i == 0) return 0;
+            // Interpolation linéaire dans le seau, bornée par les extrêmes observés
+            double lower = static_cast<double>(std::uint64_t(1) << (i - 1));
+            double upper = static_cast<double>(bucketUpperBound(i));
+            double fraction = (static_cast<double>(rank - seen) + 0.5) / static_cast<double>(bucket);
+            std::uint64_t value = static_cast<std::uint64_t>(lower + fraction * (upper - lower));
+            return std::min(std::max(value, getMin()), getMax());
+        }
+        seen += bucket;
+    }
+    return getMax();
+}
+
+Metrics& Metrics::instance() {
+    static Metrics metrics;
+    return metrics;
+}
+
+const char* Metrics::getPhaseName(Phase phase) {
+    switch (phase) {
+        case Phase::NeighborCount: return "grid.neighbors";
+        case Phase::RuleApply: return "grid.rule";
+        case Phase::StateApply: return "grid.apply";
+        case Phase::Snapshot: return "game.snapshot";
+        case Phase::StabilityCheck: return "game.stability";
+        case Phase::Step: return "game.step";
+        case Phase::FileLoad: return "io.load";
+        case Phase::FileSave: return "io.save";
+        default: return "unknown";
+    }
+}
+
+void Metrics::reset() {
+    for (auto& histogram : m_histograms) {
+        histogram.reset();
+    }
+}
+
+void Metrics::writeJson(std::ostream& out) const {
+    out << "{\n  \"unit\": \"ns\",\n  \"phases\": {";
+    bool first = true;
+    for (int p = 0; p < static_cast<int>(Phase::Count); ++p) {
+        const Histogram& histogram = m_histograms[p];
+        std::uint64_t count = histogram.getCount();
+        if (count == 0) continue;
+
+        out << (first ? "\n" : ",\n");
+        first = false;
+        out << "    \"" << getPhaseName(static_cast<Phase>(p)) << "\": {"
+            << "\"count\": " << count
+            << ", \"total_ns\": " << histogram.getSum()
+            << ", \"mean_ns\": " << histogram.getSum() / count
+            << ", \"min_ns\": " << histogram.getMin()
+            << ", \"max_ns\": " << histogram.getMax()
+            << ", \"p50_ns\": " << histogram.percentile(0.50)
+            << ", \"p90_ns\": " << histogram.percentile(0.90)
+            << ", \"p99_ns\": " << histogram.percentile(0.99)
+            << ", \"buckets\": [";
+
+        // Seaux non vides : nombre de mesures strictement inférieures à "lt" (et >= au seau précédent)
+        bool firstBucket = true;
+        for (int i = 0; i < Histogram::BUCKET_COUNT; ++i) {
+            std::uint64_t bucket = histogram.getBucket(i);
+            if (bucket == 0) continue;
+            out << (firstBucket ? "" : ", ") << "{\"lt\": " << (i == 0 ? 1 : bucketUpperBound(i))
+                << ", \"count\": " << bucket << "}";
+            firstBucket = false;
+        }
+        out << "]}";
+    }
+    out << (first ? "}\n}\n" : "\n  }\n}\n");
+}
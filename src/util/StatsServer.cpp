@@ -0,0 +1,242 @@
+#include "util/StatsServer.hpp"
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define STATS_SERVER_POSIX
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <cerrno>
+#endif
+
+namespace {
+
+/**
+ * @brief Écrit une métrique avec ses lignes HELP et TYPE
+ */
+template <typename T>
+void writeGauge(std::ostream& out, const char* name, const char* help, T value) {
+    out << "# HELP " << name << " " << help << "\n"
+        << "# TYPE " << name << " gauge\n"
+        << name << " " << value << "\n";
+}
+
+} // namespace
+
+StatsServer::StatsServer()
+    : m_generation(0)
+    , m_population(0)
+    , m_activeTiles(0)
+    , m_cellCount(0)
+    , m_populationGeneration(0)
+    , m_checkpointQueueDepth(0)
+    , m_outputWriteSeconds(0.0)
+    , m_populationRequested(false)
+    , m_lastPublish(monotonicNanoseconds())
+    , m_generationRate(0.0)
+    , m_stopping(false)
+    , m_socket(-1)
+    , m_port(0)
+{
+}
+
+StatsServer::~StatsServer() {
+    stop();
+}
+
+std::int64_t StatsServer::monotonicNanoseconds() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void StatsServer::start(int port) {
+    if (isRunning()) {
+        throw std::runtime_error("Metrics endpoint already started");
+    }
+    if (port < 0 || port > 65535) {
+        throw std::invalid_argument("Invalid metrics port: " + std::to_string(port));
+    }
+
+#ifdef STATS_SERVER_POSIX
+    int fd = socket(AF_INET, SOCK_STREAM, 0);
+    if (fd < 0) {
+        throw std::runtime_error(std::string("Cannot create metrics socket: ") + std::strerror(errno));
+    }
+    int reuse = 1;
+    setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+    sockaddr_in address;
+    std::memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    address.sin_port = htons(static_cast<uint16_t>(port));
+    if (bind(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) < 0 || listen(fd, 8) < 0) {
+        std::string error = std::strerror(errno);
+        close(fd);
+        throw std::runtime_error("Cannot listen on 127.0.0.1:" + std::to_string(port) + ": " + error);
+    }
+
+    socklen_t length = sizeof(address);
+    getsockname(fd, reinterpret_cast<sockaddr*>(&address), &length);
+    m_port = ntohs(address.sin_port);
+    m_socket = fd;
+    m_stopping.store(false);
+    m_lastPublish.store(monotonicNanoseconds(), std::memory_order_relaxed);
+    m_thread = std::thread(&StatsServer::run, this);
+#else
+    throw std::runtime_error("Metrics endpoint requires POSIX sockets");
+#endif
+}
+
+void StatsServer::stop() {
+    if (!isRunning()) return;
+    m_stopping.store(true);
+    if (m_thread.joinable()) m_thread.join();
+#ifdef STATS_SERVER_POSIX
+    close(m_socket);
+#endif
+    m_socket = -1;
+}
+
+void StatsServer::publishGeneration(long long generation, long long cellCount) {
+    m_generation.store(generation, std::memory_order_relaxed);
+    m_cellCount.store(cellCount, std::memory_order_relaxed);
+    m_lastPublish.store(monotonicNanoseconds(), std::memory_order_relaxed);
+}
+
+void StatsServer::publishPopulation(long long generation, long long population, long long activeTiles) {
+    m_population.store(population, std::memory_order_relaxed);
+    m_activeTiles.store(activeTiles, std::memory_order_relaxed);
+    m_populationGeneration.store(generation, std::memory_order_relaxed);
+}
+
+void StatsServer::run() {
+#ifdef STATS_SERVER_POSIX
+    // Échantillon de référence pour le débit, renouvelé chaque seconde
+    std::int64_t sampleTime = monotonicNanoseconds();
+    long long sampleGeneration = m_generation.load(std::memory_order_relaxed);
+
+    while (!m_stopping.load()) {
+        pollfd listener = {m_socket, POLLIN, 0};
+        int ready = poll(&listener, 1, 250);
+
+        std::int64_t now = monotonicNanoseconds();
+        if (now - sampleTime >= 1000000000LL) {
+            long long generation = m_generation.load(std::memory_order_relaxed);
+            double seconds = static_cast<double>(now - sampleTime) / 1e9;
+            m_generationRate.store(static_cast<double>(generation - sampleGeneration) / seconds,
+                                   std::memory_order_relaxed);
+            sampleTime = now;
+            sampleGeneration = generation;
+        }
+
+        if (ready > 0 && (listener.revents & POLLIN)) {
+            int client = accept(m_socket, nullptr, nullptr);
+            if (client >= 0) {
+                serve(client);
+                close(client);
+            }
+        }
+    }
+#endif
+}
+
+void StatsServer::serve(int client) {
+#ifdef STATS_SERVER_POSIX
+    // Seule la ligne de requête est utile ; un client lent ne bloque pas plus d'une seconde
+    std::string request;
+    char buffer[1024];
+    while (request.find("\r\n") == std::string::npos && request.size() < 8192) {
+        pollfd input = {client, POLLIN, 0};
+        if (poll(&input, 1, 1000) <= 0) return;
+        ssize_t received = recv(client, buffer, sizeof(buffer), 0);
+        if (received <= 0) return;
+        request.append(buffer, static_cast<size_t>(received));
+    }
+
+    std::string status = "200 OK";
+    std::string body;
+    bool metricsPath = request.compare(0, 12, "GET /metrics") == 0 &&
+                       (request[12] == ' ' || request[12] == '?');
+    if (metricsPath) {
+        body = render();
+        m_populationRequested.store(true, std::memory_order_relaxed);
+    } else if (request.compare(0, 4, "GET ") == 0) {
+        status = "404 Not Found";
+        body = "Not found: use /metrics\n";
+    } else {
+        status = "405 Method Not Allowed";
+        body = "Only GET is supported\n";
+    }
+
+    std::ostringstream response;
+    response << "HTTP/1.1 " << status << "\r\n"
+             << "Content-Type: text/plain; version=0.0.4; charset=utf-8\r\n"
+             << "Content-Length: " << body.size() << "\r\n"
+             << "Connection: close\r\n\r\n"
+             << body;
+    std::string data = response.str();
+
+    int flags = 0;
+#ifdef MSG_NOSIGNAL
+    flags = MSG_NOSIGNAL;
+#endif
+    size_t sent = 0;
+    while (sent < data.size()) {
+        ssize_t written = send(client, data.data() + sent, data.size() - sent, flags);
+        if (written <= 0) return;
+        sent += static_cast<size_t>(written);
+    }
+#else
+    (void)client;
+#endif
+}
+
+std::string StatsServer::render() const {
+    double rate = m_generationRate.load(std::memory_order_relaxed);
+    double age = static_cast<double>(monotonicNanoseconds() - m_lastPublish.load(std::memory_order_relaxed)) / 1e9;
+
+    std::ostringstream out;
+    writeGauge(out, "gameoflife_generation", "Current generation.",
+               m_generation.load(std::memory_order_relaxed));
+    writeGauge(out, "gameoflife_generations_per_second", "Generations computed per second over the last sample.",
+               rate);
+    writeGauge(out, "gameoflife_cell_updates_per_second", "Cell updates per second over the last sample.",
+               rate * static_cast<double>(m_cellCount.load(std::memory_order_relaxed)));
+    writeGauge(out, "gameoflife_population", "Live cells in the current generation.",
+               m_population.load(std::memory_order_relaxed));
+    writeGauge(out, "gameoflife_active_tiles", "64x64 tiles holding at least one live cell.",
+               m_activeTiles.load(std::memory_order_relaxed));
+    writeGauge(out, "gameoflife_population_generation", "Generation at which population and active tiles were computed.",
+               m_populationGeneration.load(std::memory_order_relaxed));
+    writeGauge(out, "gameoflife_checkpoint_queue_depth", "Checkpoints waiting in the background checkpoint writer.",
+               m_checkpointQueueDepth.load(std::memory_order_relaxed));
+    writeGauge(out, "gameoflife_output_write_seconds", "Duration of the last synchronous generation output write.",
+               m_outputWriteSeconds.load(std::memory_order_relaxed));
+    writeGauge(out, "gameoflife_last_generation_age_seconds", "Seconds since the last generation was published.",
+               age);
+
+    long long rss = residentMemoryBytes();
+    if (rss > 0) {
+        writeGauge(out, "process_resident_memory_bytes", "Resident memory size in bytes.", rss);
+    }
+    return out.str();
+}
+
+long long StatsServer::residentMemoryBytes() {
+#if defined(__linux__)
+    // /proc/self/statm : taille totale puis pages résidentes
+    std::ifstream statm("/proc/self/statm");
+    long long pages = 0;
+    long long resident = 0;
+    if (statm >> pages >> resident) {
+        return resident * sysconf(_SC_PAGESIZE);
+    }
+#endif
+    return 0;
+}
@@ -0,0 +1,87 @@
+#include "util/ThreadPool.hpp"
+#include "util/Tracer.hpp"
+
+ThreadPool::ThreadPool(unsigned int threadCount)
+    : m_task(nullptr)
+    , m_count(0)
+    , m_next(0)
+    , m_active(0)
+    , m_generation(0)
+    , m_stopping(false)
+{
+    if (threadCount == 0) {
+        threadCount = std::thread::hardware_concurrency();
+        if (threadCount == 0) threadCount = 4;
+    }
+
+    m_workers.reserve(threadCount);
+    for (unsigned int i = 0; i < threadCount; ++i) {
+        m_workers.emplace_back(&ThreadPool::workerLoop, this, i);
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_wakeUp.notify_all();
+    for (auto& worker : m_workers) {
+        worker.join();
+    }
+}
+
+void ThreadPool::workerLoop(unsigned int worker) {
+    Tracer::setThreadName("pool " + std::to_string(worker));
+    unsigned long seen = 0;
+    for (;;) {
+        const Task* task;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_wakeUp.wait(lock, [this, seen]() { return m_stopping || m_generation != seen; });
+            if (m_stopping) return;
+            seen = m_generation;
+            task = m_task;
+        }
+
+        for (;;) {
+            size_t index = m_next.fetch_add(1);
+            if (index >= m_count) break;
+            try {
+                (*task)(index, worker);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if (!m_error) m_error = std::current_exception();
+                m_next.store(m_count);
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (--m_active == 0) m_done.notify_all();
+    }
+}
+
+void ThreadPool::parallelFor(size_t count, const Task& task) {
+    if (count == 0) return;
+
+    std::lock_guard<std::mutex> call(m_callMutex);
+    std::exception_ptr error;
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_task = &task;
+        m_count = count;
+        m_next.store(0);
+        m_active = static_cast<unsigned int>(m_workers.size());
+        m_error = nullptr;
+        ++m_generation;
+        m_wakeUp.notify_all();
+
+        m_done.wait(lock, [this]() { return m_active == 0; });
+        m_task = nullptr;
+        error = m_error;
+    }
+
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
@@ -0,0 +1,135 @@
+#include "util/Tracer.hpp"
+#include <iomanip>
+
+std::atomic<bool> Tracer::s_enabled{false};
+
+namespace {
+
+thread_local std::string t_threadName;     ///< Nom donné par setThreadName
+thread_local int t_track = -1;              ///< Piste du thread (-1 = pas encore attribuée)
+
+/**
+ * @brief Échappe une chaîne JSON
+ */
+std::string jsonString(const std::string& value) {
+    std::string escaped = "\"";
+    for (char c : value) {
+        if (c == '"' || c == '\\') escaped += '\\';
+        escaped += c;
+    }
+    return escaped + "\"";
+}
+
+/**
+ * @brief Nanosecondes en microsecondes (unité du format), avec trois décimales
+ */
+void writeMicroseconds(std::ostream& out, std::uint64_t nanoseconds) {
+    out << nanoseconds / 1000 << '.' << std::setw(3) << std::setfill('0') << nanoseconds % 1000
+        << std::setfill(' ');
+}
+
+} // namespace
+
+Tracer::Tracer()
+    : m_maxEvents(0)
+    , m_dropped(0)
+    , m_origin(std::chrono::steady_clock::now())
+{
+}
+
+Tracer& Tracer::instance() {
+    static Tracer tracer;
+    return tracer;
+}
+
+void Tracer::start(size_t maxEvents) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_events.clear();
+        m_maxEvents = maxEvents;
+        m_dropped = 0;
+        m_origin = std::chrono::steady_clock::now();
+    }
+    s_enabled.store(true, std::memory_order_relaxed);
+}
+
+void Tracer::stop() {
+    s_enabled.store(false, std::memory_order_relaxed);
+}
+
+void Tracer::setThreadName(const std::string& name) {
+    t_threadName = name;
+    t_track = -1;
+}
+
+int Tracer::currentTrack() {
+    if (t_track >= 0) return t_track;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::string name = t_threadName.empty() ? "thread " + std::to_string(m_trackNames.size()) : t_threadName;
+    int track = -1;
+    for (size_t i = 0; i < m_trackNames.size(); ++i) {
+        if (m_trackNames[i] == name) {
+            track = static_cast<int>(i);
+            break;
+        }
+    }
+    if (track < 0) {
+        track = static_cast<int>(m_trackNames.size());
+        m_trackNames.push_back(name);
+    }
+    t_track = track;
+    return track;
+}
+
+void Tracer::record(const Event& event) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_events.size() >= m_maxEvents) {
+        ++m_dropped;
+        return;
+    }
+    m_events.push_back(event);
+}
+
+size_t Tracer::getEventCount() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_events.size();
+}
+
+size_t Tracer::getDroppedCount() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_dropped;
+}
+
+void Tracer::writeJson(std::ostream& out) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    out << "{\"displayTimeUnit\": \"ms\", \"otherData\": {\"dropped_events\": " << m_dropped << "},\n"
+        << "\"traceEvents\": [\n";
+    out << "{\"name\": \"process_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": 0, \"args\": {\"name\": \"gameoflife\"}}";
+
+    // Noms des pistes, triées dans l'ordre de création
+    for (size_t i = 0; i < m_trackNames.size(); ++i) {
+        out << ",\n{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": " << i
+            << ", \"args\": {\"name\": " << jsonString(m_trackNames[i]) << "}}"
+            << ",\n{\"name\": \"thread_sort_index\", \"ph\": \"M\", \"pid\": 1, \"tid\": " << i
+            << ", \"args\": {\"sort_index\": " << i << "}}";
+    }
+
+    for (const auto& event : m_events) {
+        out << ",\n{\"name\": " << jsonString(event.name) << ", \"cat\": " << jsonString(event.category)
+            << ", \"ph\": \"X\", \"pid\": 1, \"tid\": " << event.track << ", \"ts\": ";
+        writeMicroseconds(out, event.start);
+        out << ", \"dur\": ";
+        writeMicroseconds(out, event.duration);
+        if (event.argCount > 0) {
+            out << ", \"args\": {";
+            for (int i = 0; i < event.argCount; ++i) {
+                out << (i > 0 ? ", " : "") << jsonString(event.argNames[i]) << ": " << event.argValues[i];
+            }
+            out << "}";
+        }
+        out << "}";
+    }
+    out << "\n]}\n";
+}